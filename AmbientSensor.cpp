@@ -18,7 +18,7 @@
  * 
  * @param pin The GPIO pin connected to the DHT22 sensor.
  */
-AmbientSensor::AmbientSensor(uint8_t pin) : dht(pin, DHT22) {}
+AmbientSensor::AmbientSensor(uint8_t pin) : dht(pin, DHT22), pin(pin) {}
 
 /**
  * @brief Initializes the DHT sensor.
@@ -56,3 +56,24 @@ float AmbientSensor::getTemperature() {
 float AmbientSensor::getHumidity() {
   return humidity;
 }
+
+/**
+ * @brief Returns the GPIO pin currently assigned to the DHT22.
+ *
+ * @return uint8_t Pin number.
+ */
+uint8_t AmbientSensor::getPin() {
+  return pin;
+}
+
+/**
+ * @brief Reassigns the GPIO pin of the DHT22.
+ *
+ * Takes effect on the next call to begin().
+ *
+ * @param newPin New GPIO pin.
+ */
+void AmbientSensor::setPin(uint8_t newPin) {
+  pin = newPin;
+  dht = DHT(newPin, DHT22);
+}
@@ -25,6 +25,7 @@
 class AmbientSensor {
   private:
     DHT dht;               ///< Instance of the DHT sensor.
+    uint8_t pin;           ///< GPIO pin where the DHT22 is connected.
     float temperature;     ///< Last measured temperature (°C).
     float humidity;        ///< Last measured humidity (%).
 
@@ -63,6 +64,22 @@ class AmbientSensor {
      * @return float Relative humidity in percentage.
      */
     float getHumidity();
+
+    /**
+     * @brief Gets the GPIO pin currently assigned to the DHT22.
+     *
+     * @return uint8_t Pin number.
+     */
+    uint8_t getPin();
+
+    /**
+     * @brief Reassigns the GPIO pin of the DHT22.
+     *
+     * Call begin() afterwards to configure the new pin.
+     *
+     * @param newPin New GPIO pin.
+     */
+    void setPin(uint8_t newPin);
 };
 
 #endif // AMBIENT_SENSOR_H
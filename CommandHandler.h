@@ -21,6 +21,8 @@
 /**
  * @class CommandHandler
  * @brief Interface for handling string-based commands and their associated payloads.
+ *
+ * Arguments are plain C strings so implementations never need heap-allocated `String` objects.
  */
 class CommandHandler {
 public:
@@ -32,7 +34,7 @@ public:
      * @param command The name or type of the command (e.g., "SET_MODE").
      * @param payload Optional data or parameters associated with the command.
      */
-    virtual void handleCommand(const String& command, const String& payload) = 0;
+    virtual void handleCommand(const char* command, const char* payload) = 0;
 
     /**
      * @brief Virtual destructor to allow proper cleanup from base pointers.
@@ -38,9 +38,9 @@ public:
     /**
      * @brief Returns a unique identifier or description of the device.
      * 
-     * @return String representing the device ID or name.
+     * @return Null-terminated device ID or name, owned by the device.
      */
-    virtual String getId() = 0;
+    virtual const char* getId() = 0;
 
     /**
      * @brief Virtual destructor to support proper deletion via base class pointer.
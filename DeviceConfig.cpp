@@ -0,0 +1,133 @@
+/**
+ * @file DeviceConfig.cpp
+ * @brief Implementation of the DeviceConfig record helpers.
+ *
+ * Provides sealing and in-place validation of the binary configuration record.
+ *
+ * Project: Allpa Kawsay - IoT Agricultural Monitoring
+ *
+ * @author Sharon Antuanet Ivet Barrial Marin
+ * @code U202114900
+ */
+
+#include "DeviceConfig.h"
+#include <stddef.h>
+
+/// Offset of the first byte covered by the CRC.
+static const size_t CRC_START = offsetof(DeviceConfig, crc) + sizeof(uint32_t);
+/// Highest GPIO number on the ESP32.
+static const uint8_t MAX_GPIO = 39;
+/// GPIOs from here up are input-only (no output driver).
+static const uint8_t FIRST_INPUT_ONLY_GPIO = 34;
+/// First GPIO on ADC1; ADC1 covers GPIO 32-39.
+static const uint8_t FIRST_ADC1_GPIO = 32;
+
+/**
+ * @brief Checks that a pin is an ESP32 GPIO available to the application.
+ *
+ * Excludes GPIOs that do not exist (20, 24, 28-31) and those wired to the
+ * SPI flash (6-11).
+ *
+ * @param pin GPIO number.
+ * @return true if the pin can be used.
+ */
+static bool isUsableGpio(uint8_t pin) {
+  if (pin > MAX_GPIO || (pin >= 6 && pin <= 11)) {
+    return false;
+  }
+  return pin != 20 && pin != 24 && !(pin >= 28 && pin <= 31);
+}
+
+/**
+ * @brief Checks that a pin is usable and can drive an output.
+ *
+ * @param pin GPIO number.
+ * @return true if the pin can be configured as OUTPUT.
+ */
+static bool isOutputGpio(uint8_t pin) {
+  return isUsableGpio(pin) && pin < FIRST_INPUT_ONLY_GPIO;
+}
+
+/**
+ * @brief Checks that a pin is an ADC1 channel.
+ *
+ * ADC2 pins cannot be read while WiFi is running, and the other GPIOs have
+ * no ADC at all, so the soil sensor is limited to ADC1.
+ *
+ * @param pin GPIO number.
+ * @return true if analogRead() works on the pin with WiFi enabled.
+ */
+static bool isAdc1Gpio(uint8_t pin) {
+  return pin >= FIRST_ADC1_GPIO && pin <= MAX_GPIO;
+}
+
+/**
+ * @brief Computes the CRC-32 of the record payload.
+ *
+ * Bitwise implementation; the payload is only a few dozen bytes, so a lookup
+ * table would cost more RAM than it saves time.
+ *
+ * @param config Record to checksum.
+ * @return CRC-32 of the bytes following the `crc` field.
+ */
+uint32_t deviceConfigCrc(const DeviceConfig& config) {
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&config);
+  uint32_t crc = 0xFFFFFFFFUL;
+
+  for (size_t i = CRC_START; i < sizeof(DeviceConfig); i++) {
+    crc ^= bytes[i];
+    for (uint8_t bit = 0; bit < 8; bit++) {
+      crc = (crc >> 1) ^ (0xEDB88320UL & (0UL - (crc & 1)));
+    }
+  }
+  return ~crc;
+}
+
+/**
+ * @brief Writes the header fields and CRC of a record.
+ *
+ * @param config Record to seal.
+ */
+void sealDeviceConfig(DeviceConfig& config) {
+  config.magic = DEVICE_CONFIG_MAGIC;
+  config.version = DEVICE_CONFIG_VERSION;
+  config.size = sizeof(DeviceConfig);
+  config.crc = deviceConfigCrc(config);
+}
+
+/**
+ * @brief Validates a record without copying or parsing it.
+ *
+ * Rejects records with a wrong header or CRC, non-zero reserved bytes, an
+ * unterminated MAC, inverted thresholds, a zero report period, a soil pin outside
+ * ADC1, or a pin that is unusable, input-only where an output is needed, or shared
+ * with another component.
+ *
+ * @param config Record to validate.
+ * @return true if the record can be applied.
+ */
+bool isValidDeviceConfig(const DeviceConfig& config) {
+  if (config.magic != DEVICE_CONFIG_MAGIC || config.version != DEVICE_CONFIG_VERSION ||
+      config.size != sizeof(DeviceConfig) || config.crc != deviceConfigCrc(config)) {
+    return false;
+  }
+  if (config.reserved != 0 || config.padding[0] != 0 || config.padding[1] != 0) {
+    return false;
+  }
+  if (config.mac[MAC_ADDRESS_CAPACITY - 1] != '\0') {
+    return false;
+  }
+  if (!isAdc1Gpio(config.soilPin) || !isOutputGpio(config.ambientPin) ||
+      !isOutputGpio(config.valvePin)) {
+    return false;
+  }
+  if (config.soilPin == config.ambientPin || config.soilPin == config.valvePin ||
+      config.ambientPin == config.valvePin) {
+    return false;
+  }
+  if (!(config.openBelowPercent >= 0.0f && config.openBelowPercent <= config.manualAbovePercent &&
+        config.manualAbovePercent <= 100.0f)) {
+    return false;
+  }
+  return config.reportPeriodMs > 0;
+}
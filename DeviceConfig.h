@@ -0,0 +1,84 @@
+/**
+ * @file DeviceConfig.h
+ * @brief Binary configuration record for the Allpa Kawsay IoT device.
+ *
+ * Defines a fixed-layout, versioned and CRC-checked record holding the irrigation
+ * thresholds, report period, pin assignment and MAC address. The record is stored
+ * and transferred as raw bytes and used in place after validation, so no text
+ * parsing happens at boot or on reconfiguration.
+ *
+ * Project: Allpa Kawsay - IoT Agricultural Monitoring
+ * Platform: ESP32 + ModestIoT
+ *
+ * @author Sharon Antuanet Ivet Barrial Marin
+ * @code U202114900
+ */
+
+#ifndef DEVICE_CONFIG_H
+#define DEVICE_CONFIG_H
+
+#include <Arduino.h>
+
+/// Capacity of the MAC address buffer ("AA:BB:CC:DD:EE:FF" plus terminator).
+#define MAC_ADDRESS_CAPACITY 18
+
+/// Record marker ("AKCF" read as a little-endian word).
+#define DEVICE_CONFIG_MAGIC 0x46434B41UL
+
+/// Layout version; bump whenever a field is added, removed or reordered.
+#define DEVICE_CONFIG_VERSION 1
+
+/**
+ * @struct DeviceConfig
+ * @brief Raw configuration record, little-endian, 48 bytes.
+ *
+ * The CRC-32 covers every byte after the `crc` field.
+ */
+struct DeviceConfig {
+  uint32_t magic;                 ///< Must equal DEVICE_CONFIG_MAGIC.
+  uint16_t version;               ///< Must equal DEVICE_CONFIG_VERSION.
+  uint16_t size;                  ///< Must equal sizeof(DeviceConfig).
+  uint32_t crc;                   ///< CRC-32 (IEEE) of the bytes following this field.
+  float openBelowPercent;         ///< AUTO mode opens the valve below this soil moisture (%).
+  float manualAbovePercent;       ///< Switches to MANUAL mode above this soil moisture (%).
+  uint32_t reportPeriodMs;        ///< Period between JSON status reports (ms).
+  uint8_t soilPin;                ///< Analog pin of the soil moisture sensor (ADC1, GPIO 32-39).
+  uint8_t ambientPin;             ///< Data pin of the DHT22 sensor (output-capable GPIO).
+  uint8_t valvePin;               ///< Output pin of the valve relay (output-capable GPIO).
+  uint8_t reserved;               ///< Must be 0.
+  char mac[MAC_ADDRESS_CAPACITY]; ///< Null-terminated MAC address used in reports.
+  uint8_t padding[2];             ///< Must be 0; keeps the record 4-byte aligned.
+};
+
+static_assert(sizeof(DeviceConfig) == 48, "DeviceConfig layout changed; bump DEVICE_CONFIG_VERSION");
+
+/**
+ * @brief Computes the CRC-32 of the record payload (all bytes after `crc`).
+ *
+ * @param config Record to checksum.
+ * @return CRC-32 (IEEE 802.3 polynomial).
+ */
+uint32_t deviceConfigCrc(const DeviceConfig& config);
+
+/**
+ * @brief Fills in the header (magic, version, size) and CRC of a record.
+ *
+ * Call after editing any field and before storing or sending the record.
+ *
+ * @param config Record to seal.
+ */
+void sealDeviceConfig(DeviceConfig& config);
+
+/**
+ * @brief Checks header, CRC, field ranges and pin assignment of a record in place.
+ *
+ * Pins must be existing ESP32 GPIOs not wired to the SPI flash (6-11), the soil
+ * pin must be on ADC1 (32-39, usable with WiFi on), the DHT22 and valve pins
+ * must be able to drive output (not 34-39), and no two pins may be the same. `reserved` and `padding` must be zero.
+ *
+ * @param config Record to validate.
+ * @return true if the record can be applied.
+ */
+bool isValidDeviceConfig(const DeviceConfig& config);
+
+#endif // DEVICE_CONFIG_H
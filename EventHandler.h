@@ -20,6 +20,8 @@
 /**
  * @class EventHandler
  * @brief Interface for reacting to events emitted by sensors, actuators, or system logic.
+ *
+ * Arguments are plain C strings so implementations never need heap-allocated `String` objects.
  */
 class EventHandler {
 public:
@@ -31,7 +33,7 @@ public:
      * @param eventType A string representing the type of event (e.g., "MOISTURE_LOW", "VALVE_OPENED").
      * @param data Additional information or payload related to the event (e.g., moisture value).
      */
-    virtual void handleEvent(const String& eventType, const String& data) = 0;
+    virtual void handleEvent(const char* eventType, const char* data) = 0;
 
     /**
      * @brief Virtual destructor to ensure proper cleanup in derived classes.
@@ -4,7 +4,8 @@
  * 
  * This class coordinates soil moisture readings, environmental data acquisition, and 
  * solenoid valve control. It supports AUTO and MANUAL operation modes and reports 
- * device status every 5 seconds in JSON format via serial output.
+ * device status periodically in JSON format. Thresholds, report period, pins and MAC
+ * come from a double-buffered binary configuration record.
  * 
  * Project: Allpa Kawsay - Smart Agriculture IoT Platform
  * Platform: ESP32 on Wokwi
@@ -16,41 +17,155 @@
 #include "SmartIrrigationController.h"
 #include <OneWire.h>
 #include <WiFi.h>
-#include "time.h"
+#include <Preferences.h>
 
-/// WiFi credentials for Wokwi simulation
-const char* WIFI_SSID = "Wokwi-GUEST";
-const char* WIFI_PASSWORD = "";
+/// Preferences namespace holding persisted DeviceConfig records (one key per instance).
+static const char* CONFIG_NAMESPACE = "allpa";
 
 /**
  * @brief Constructor for the SmartIrrigationController class.
  * 
- * Initializes all internal components (soil sensor, ambient sensor, valve) and sets
- * the default irrigation mode to AUTO.
+ * Initializes all internal components (soil sensor, ambient sensor, valve), sets
+ * the default irrigation mode to AUTO and seals the default configuration in slot 0.
  * 
- * @param macAddr The MAC address of the device, used for identifying the node in reports.
+ * @param macAddr The default MAC address of the device, used for identifying the node in reports.
+ * @param out Output stream for logs and JSON reports.
+ * @param wifiSsid WiFi network name, or nullptr to run without networking.
+ * @param wifiPassword WiFi password.
+ * @param epochSource UTC source passed to the time service.
+ * @param configKey Preferences key for the persisted config, or nullptr for none.
  */
-SmartIrrigationController::SmartIrrigationController(String macAddr)
-  : mac(macAddr), soilSensor(34), ambientSensor(4), valve(12), mode("AUTO"), lastUpdate(0) {}
+SmartIrrigationController::SmartIrrigationController(const char* macAddr, Print& out,
+                                                     const char* wifiSsid, const char* wifiPassword,
+                                                     EpochSource epochSource, const char* configKey)
+  : out(out), wifiSsid(wifiSsid), wifiPassword(wifiPassword), configKey(configKey),
+    activeSlot(0), configGeneration(0),
+    appliedGeneration(0), lastApplyMicros(0), soilSensor(34), ambientSensor(4), valve(12),
+    timeService(epochSource), mode(MODE_AUTO), lastUpdate(0) {
+  memset(configSlots, 0, sizeof(configSlots));
+
+  DeviceConfig& config = configSlots[0];
+  config.openBelowPercent = 40.0f;
+  config.manualAbovePercent = 80.0f;
+  config.reportPeriodMs = 5000;
+  config.soilPin = 34;
+  config.ambientPin = 4;
+  config.valvePin = 12;
+  strncpy(config.mac, macAddr, MAC_ADDRESS_CAPACITY - 1);
+  sealDeviceConfig(config);
+}
+
+/**
+ * @brief Returns the name of the current operation mode as used in reports.
+ *
+ * @return "AUTO" or "MANUAL".
+ */
+const char* SmartIrrigationController::modeName() const {
+  return mode == MODE_AUTO ? "AUTO" : "MANUAL";
+}
+
+/**
+ * @brief Reads the persisted record straight into the inactive slot.
+ *
+ * The bytes are validated in place; a missing or corrupt record, or disabled
+ * persistence, leaves the defaults active.
+ */
+void SmartIrrigationController::loadStoredConfig() {
+  if (configKey == nullptr) {
+    return;
+  }
+
+  Preferences prefs;
+  if (!prefs.begin(CONFIG_NAMESPACE, true)) {
+    return;
+  }
+
+  uint8_t inactive = 1 - activeSlot.load();
+  size_t length = prefs.getBytes(configKey, &configSlots[inactive], sizeof(DeviceConfig));
+  prefs.end();
+
+  if (length == sizeof(DeviceConfig) && isValidDeviceConfig(configSlots[inactive])) {
+    activeSlot.store(inactive);
+    configGeneration.fetch_add(1);
+    out.println("Stored configuration loaded.");
+  }
+}
+
+/**
+ * @brief Persists a record as raw bytes under this instance's key.
+ *
+ * Does nothing when persistence is disabled.
+ *
+ * @param config Record to store.
+ */
+void SmartIrrigationController::storeConfig(const DeviceConfig& config) {
+  if (configKey == nullptr) {
+    return;
+  }
+
+  Preferences prefs;
+  if (!prefs.begin(CONFIG_NAMESPACE, false)) {
+    return;
+  }
+  prefs.putBytes(configKey, &config, sizeof(DeviceConfig));
+  prefs.end();
+}
+
+/**
+ * @brief Re-initializes only the components whose pin changed.
+ *
+ * The valve is closed on its old pin before moving so the relay is not left open.
+ *
+ * @param config Record holding the new pin assignment.
+ */
+void SmartIrrigationController::applyPins(const DeviceConfig& config) {
+  if (soilSensor.getPin() != config.soilPin) {
+    soilSensor.setPin(config.soilPin);
+    soilSensor.begin();
+  }
+  if (ambientSensor.getPin() != config.ambientPin) {
+    ambientSensor.setPin(config.ambientPin);
+    ambientSensor.begin();
+  }
+  if (valve.getPin() != config.valvePin) {
+    valve.close();
+    valve.setPin(config.valvePin);
+    valve.begin();
+  }
+}
 
 /**
  * @brief Initializes all components and displays device metadata.
  * 
- * Establishes WiFi connection (Wokwi simulation), and initializes the sensors and actuator.
+ * Establishes WiFi connection (Wokwi simulation) and starts SNTP when credentials were
+ * given, and initializes the sensors and actuator.
  */
 void SmartIrrigationController::begin() {
-  WiFi.mode(WIFI_STA);
-  WiFi.begin(WIFI_SSID, WIFI_PASSWORD);
-  
-  Serial.print("Connecting... ");
-  Serial.println("WiFi connected");
-  Serial.println("ALLPA KAWSAY S.A. - IoT Irrigation Controller");
-  Serial.println("Developer: Sharon Antuanet Ivet Barrial Marin");
-  Serial.println("Student Code: U202114900");
+  if (wifiSsid != nullptr) {
+    WiFi.mode(WIFI_STA);
+    WiFi.begin(wifiSsid, wifiPassword);
+
+    out.print("Connecting... ");
+    out.println("WiFi connected");
+  }
+  out.println("ALLPA KAWSAY S.A. - IoT Irrigation Controller");
+  out.println("Developer: Sharon Antuanet Ivet Barrial Marin");
+  out.println("Student Code: U202114900");
+
+  loadStoredConfig();
+  const DeviceConfig& config = configSlots[activeSlot.load()];
+  soilSensor.setPin(config.soilPin);
+  ambientSensor.setPin(config.ambientPin);
+  valve.setPin(config.valvePin);
+  appliedGeneration.store(configGeneration.load());
 
   soilSensor.begin();
   ambientSensor.begin();
   valve.begin();
+
+  if (wifiSsid != nullptr) {
+    timeService.begin();
+  }
 }
 
 /**
@@ -61,62 +176,179 @@ void SmartIrrigationController::begin() {
  * 
  * @param newMode A string specifying the desired operation mode ("AUTO" or "MANUAL").
  */
-void SmartIrrigationController::setMode(String newMode) {
-  if (newMode == "AUTO" || newMode == "MANUAL") {
-    mode = newMode;
-    Serial.print("Irrigation mode changed to: ");
-    Serial.println(mode);
+void SmartIrrigationController::setMode(const char* newMode) {
+  if (strcmp(newMode, "AUTO") == 0) {
+    mode = MODE_AUTO;
+  } else if (strcmp(newMode, "MANUAL") == 0) {
+    mode = MODE_MANUAL;
+  } else {
+    return;
   }
+
+  out.print("Irrigation mode changed to: ");
+  out.println(modeName());
+}
+
+/**
+ * @brief Prints the static RAM used by the controller, split by component.
+ *
+ * Sizes come from `sizeof`, so they reflect exactly what the controller reserves statically.
+ * Heap usage is a per-process figure and is checked by the sketch, not here.
+ */
+void SmartIrrigationController::printMemoryReport() {
+  size_t members = sizeof(SoilMoistureSensor) + sizeof(AmbientSensor) + sizeof(ValveActuator) +
+                   sizeof(TimeService) + sizeof(configSlots);
+
+  out.print(F("{\"memoryReport\":{\"total\":"));
+  out.print(sizeof(SmartIrrigationController));
+  out.print(F(",\"controllerOverhead\":"));
+  out.print(sizeof(SmartIrrigationController) - members);
+  out.print(F(",\"soilSensor\":"));
+  out.print(sizeof(SoilMoistureSensor));
+  out.print(F(",\"ambientSensor\":"));
+  out.print(sizeof(AmbientSensor));
+  out.print(F(",\"valve\":"));
+  out.print(sizeof(ValveActuator));
+  out.print(F(",\"timeService\":"));
+  out.print(sizeof(TimeService));
+  out.print(F(",\"configSlots\":"));
+  out.print(sizeof(configSlots));
+  out.println(F("}}"));
 }
 
 /**
  * @brief Main update logic for irrigation control and data reporting.
  * 
- * - Reads data from sensors.
+ * - Reads data from sensors and refreshes the wall-clock sync.
  * - In AUTO mode, controls the solenoid valve based on soil moisture.
  * - Automatically switches to MANUAL mode if the soil is too wet.
- * - Every 5 seconds, sends a JSON-formatted report to the serial console.
+ * - Every report period, sends a JSON-formatted report to the output stream.
+ *   `createdAt` is UTC ISO-8601 once synced, or an uptime duration before that.
  */
 void SmartIrrigationController::update() {
+  update(millis());
+}
+
+/**
+ * @brief Runs one control step at the given monotonic time.
+ *
+ * Same logic as update(), with time supplied by the caller so simulated
+ * instances can each run on their own clock.
+ *
+ * @param now Monotonic time in milliseconds.
+ */
+void SmartIrrigationController::update(unsigned long now) {
+  // Generation is read before the slot index, so a generation acknowledged
+  // below never refers to a slot newer than the one in use.
+  uint32_t generation = configGeneration.load(std::memory_order_acquire);
+  const DeviceConfig& config = configSlots[activeSlot.load(std::memory_order_acquire)];
+  if (generation != appliedGeneration.load(std::memory_order_relaxed)) {
+    applyPins(config);
+    appliedGeneration.store(generation, std::memory_order_release);
+  }
+
+  timeService.update(now);
+
   soilSensor.read();
   ambientSensor.read();
 
   float moisture = soilSensor.getMoisturePercent();
 
   // Auto-switch to MANUAL mode if soil is too wet
-  if (mode == "AUTO" && moisture > 80.0) {
-    mode = "MANUAL";
+  if (mode == MODE_AUTO && moisture > config.manualAbovePercent) {
+    mode = MODE_MANUAL;
     valve.close();
-    Serial.println("Excessive moisture detected. Switching to MANUAL mode.");
+    out.println("Excessive moisture detected. Switching to MANUAL mode.");
   }
 
   // AUTO mode control logic
-  if (mode == "AUTO") {
-    if (moisture < 40.0) {
+  if (mode == MODE_AUTO) {
+    if (moisture < config.openBelowPercent) {
       valve.open();
     } else {
       valve.close();
     }
   }
 
-  // JSON status report every 5 seconds
-  if (millis() - lastUpdate >= 5000) {
-    lastUpdate = millis();
-
-    Serial.print(F("{\"deviceMacAddress\":\""));
-    Serial.print(mac);
-    Serial.print(F("\",\"operationMode\":\""));
-    Serial.print(mode);
-    Serial.print(F("\",\"currentSoilMoisture\":"));
-    Serial.print(moisture, 1);
-    Serial.print(F(",\"ambientTemperature\":"));
-    Serial.print(ambientSensor.getTemperature(), 1);
-    Serial.print(F(",\"ambientHumidity\":"));
-    Serial.print(ambientSensor.getHumidity(), 1);
-    Serial.print(F(",\"createdAt\":\""));
-    Serial.print(__DATE__);
-    Serial.print(F(" "));
-    Serial.print(__TIME__);
-    Serial.println(F("\"}"));
+  // JSON status report every configured period
+  if (now - lastUpdate >= config.reportPeriodMs) {
+    lastUpdate = now;
+
+    out.print(F("{\"deviceMacAddress\":\""));
+    out.print(config.mac);
+    out.print(F("\",\"operationMode\":\""));
+    out.print(modeName());
+    out.print(F("\",\"currentSoilMoisture\":"));
+    out.print(moisture, 1);
+    out.print(F(",\"ambientTemperature\":"));
+    out.print(ambientSensor.getTemperature(), 1);
+    out.print(F(",\"ambientHumidity\":"));
+    out.print(ambientSensor.getHumidity(), 1);
+    out.print(F(",\"createdAt\":\""));
+    out.print(timeService.format(now));
+    out.println(F("\"}"));
   }
 }
+
+/**
+ * @brief Returns the active configuration record.
+ *
+ * @return Reference to the slot update() currently reads.
+ */
+const DeviceConfig& SmartIrrigationController::getConfig() const {
+  return configSlots[activeSlot.load(std::memory_order_acquire)];
+}
+
+/**
+ * @brief Validates a binary record in the inactive slot and publishes it.
+ *
+ * The inactive slot is only written once update() has acknowledged the previous
+ * swap, so a running update() never reads a slot being overwritten. The timing
+ * covers copy, CRC check and swap; persistence happens afterwards.
+ *
+ * Refusals are logged with their reason, matching the returned status.
+ *
+ * @param blob Raw DeviceConfig bytes.
+ * @param length Size of the blob.
+ * @return CONFIG_APPLIED, CONFIG_REJECTED or CONFIG_BUSY.
+ */
+ConfigApplyResult SmartIrrigationController::applyConfig(const uint8_t* blob, size_t length) {
+  unsigned long start = micros();
+
+  if (blob == nullptr || length != sizeof(DeviceConfig)) {
+    out.println("Configuration rejected: wrong record size.");
+    return CONFIG_REJECTED;
+  }
+
+  uint32_t generation = configGeneration.load(std::memory_order_relaxed);
+  if (appliedGeneration.load(std::memory_order_acquire) != generation) {
+    out.println("Configuration busy: previous record not yet applied, retry.");
+    return CONFIG_BUSY;
+  }
+
+  uint8_t inactive = 1 - activeSlot.load(std::memory_order_relaxed);
+  memcpy(&configSlots[inactive], blob, sizeof(DeviceConfig));
+  if (!isValidDeviceConfig(configSlots[inactive])) {
+    out.println("Configuration rejected: invalid header, CRC or fields.");
+    return CONFIG_REJECTED;
+  }
+
+  activeSlot.store(inactive, std::memory_order_release);
+  configGeneration.store(generation + 1, std::memory_order_release);
+  lastApplyMicros = micros() - start;
+
+  storeConfig(configSlots[inactive]);
+  out.print("Configuration applied in ");
+  out.print(lastApplyMicros);
+  out.println(" us");
+  return CONFIG_APPLIED;
+}
+
+/**
+ * @brief Returns how long the last applyConfig() validate-and-swap took.
+ *
+ * @return Duration in microseconds.
+ */
+unsigned long SmartIrrigationController::getLastApplyMicros() const {
+  return lastApplyMicros;
+}
@@ -3,7 +3,7 @@
  * @brief Header file for the SmartIrrigationController class.
  * 
  * Coordinates sensors and actuators for automated or manual irrigation control
- * based on soil and ambient conditions. Reports system status via serial in JSON format.
+ * based on soil and ambient conditions. Reports system status in JSON format to an injected stream.
  * This class is a high-level controller within the ModestIoT framework.
  * 
  * Project: Allpa Kawsay - IoT Agricultural Monitoring
@@ -16,9 +16,31 @@
 #ifndef SMART_IRRIGATION_CONTROLLER_H
 #define SMART_IRRIGATION_CONTROLLER_H
 
+#include <atomic>
+#include "DeviceConfig.h"
 #include "SoilMoistureSensor.h"
 #include "AmbientSensor.h"
 #include "ValveActuator.h"
+#include "TimeService.h"
+
+/**
+ * @enum IrrigationMode
+ * @brief Operation modes supported by the irrigation controller.
+ */
+enum IrrigationMode : uint8_t {
+  MODE_AUTO,   ///< Valve driven automatically from soil moisture.
+  MODE_MANUAL  ///< No automatic valve actions.
+};
+
+/**
+ * @enum ConfigApplyResult
+ * @brief Outcome of SmartIrrigationController::applyConfig().
+ */
+enum ConfigApplyResult : uint8_t {
+  CONFIG_APPLIED,   ///< Record validated and activated.
+  CONFIG_REJECTED,  ///< Wrong length, header, CRC or field values; resending it will fail again.
+  CONFIG_BUSY       ///< Previous record not yet picked up by update(); retry after the next update().
+};
 
 /**
  * @class SmartIrrigationController
@@ -26,29 +48,79 @@
  * 
  * Controls the irrigation valve based on soil moisture readings and operational mode (AUTO or MANUAL),
  * acquires ambient sensor data, and reports status periodically.
+ * All state is held in fixed-capacity members, so no heap allocation happens after begin().
+ * The controller owns no global state; its output stream, network credentials, clock
+ * and UTC source are supplied by the caller, so several instances can run side by side.
+ *
+ * Thresholds, report period, pins and MAC come from a double-buffered DeviceConfig:
+ * applyConfig() fills the inactive slot and publishes it with an atomic index swap,
+ * so update() always runs against a complete record.
  */
 class SmartIrrigationController {
   private:
-    String mac;                     ///< MAC address of the device (used in JSON reports).
+    Print& out;                     ///< Output stream for logs and reports (e.g. Serial).
+    const char* wifiSsid;           ///< WiFi network name, nullptr when running without network.
+    const char* wifiPassword;       ///< WiFi password.
+    const char* configKey;          ///< Preferences key of the persisted config, nullptr = no persistence.
+    DeviceConfig configSlots[2];    ///< Double-buffered configuration records.
+    std::atomic<uint8_t> activeSlot; ///< Index of the slot update() reads.
+    std::atomic<uint32_t> configGeneration;  ///< Incremented on every published swap.
+    std::atomic<uint32_t> appliedGeneration; ///< Last generation picked up by update().
+    unsigned long lastApplyMicros;  ///< Duration of the last applyConfig() validate-and-swap (us).
     SoilMoistureSensor soilSensor; ///< Soil moisture sensor instance (capacitive sensor).
     AmbientSensor ambientSensor;   ///< Ambient temperature/humidity sensor instance (DHT22).
     ValveActuator valve;           ///< Solenoid valve actuator controlled via relay.
-    String mode;                   ///< Operation mode: "AUTO" or "MANUAL".
+    TimeService timeService;       ///< Wall-clock source for report timestamps.
+    IrrigationMode mode;           ///< Operation mode: AUTO or MANUAL.
     unsigned long lastUpdate;      ///< Timestamp of the last status report (in millis).
 
+    /**
+     * @brief Returns the report name of the current mode ("AUTO" or "MANUAL").
+     */
+    const char* modeName() const;
+
+    /**
+     * @brief Loads the stored record into the inactive slot and activates it if valid.
+     */
+    void loadStoredConfig();
+
+    /**
+     * @brief Persists a record so it is used on the next boot.
+     */
+    void storeConfig(const DeviceConfig& config);
+
+    /**
+     * @brief Moves components whose pin differs from the given record and re-initializes them.
+     */
+    void applyPins(const DeviceConfig& config);
+
   public:
     /**
      * @brief Constructor for SmartIrrigationController.
      * 
-     * Initializes internal sensor and actuator components.
+     * Initializes internal sensor, actuator and time service components, and builds
+     * the default configuration (thresholds 40%/80%, report every 5 s, pins 34/4/12).
      * 
-     * @param macAddr MAC address string used for device identification in the system.
+     * @param macAddr Default MAC address used in reports until a stored config overrides it.
+     *                Copied into a fixed buffer and truncated to 17 characters.
+     * @param out Output stream for logs and JSON reports.
+     * @param wifiSsid WiFi network name, or nullptr to run without networking.
+     * @param wifiPassword WiFi password.
+     * @param epochSource UTC source for report timestamps (SNTP on the device).
+     * @param configKey Preferences key (max. 15 characters) under which this instance
+     *                  persists its config, or nullptr to keep config in RAM only.
+     *                  Instances sharing a key share their stored config.
      */
-    SmartIrrigationController(String macAddr);
+    SmartIrrigationController(const char* macAddr, Print& out,
+                              const char* wifiSsid = nullptr, const char* wifiPassword = "",
+                              EpochSource epochSource = sntpEpochSource,
+                              const char* configKey = nullptr);
 
     /**
      * @brief Initializes all sensors, actuators, and network connection.
      * 
+     * Loads the stored configuration record, if persistence is enabled and a valid
+     * one exists, before the components are initialized on its pins.
      * Must be called in the Arduino `setup()` method to prepare the device.
      */
     void begin();
@@ -59,10 +131,19 @@ class SmartIrrigationController {
      * Should be called repeatedly in the Arduino `loop()` function.
      * - Reads sensors.
      * - Controls valve (in AUTO mode).
-     * - Outputs JSON report every 5 seconds.
+     * - Outputs JSON report every configured period (5 seconds by default).
      */
     void update();
 
+    /**
+     * @brief Executes one control step at a caller-supplied monotonic time.
+     *
+     * Lets simulations step each instance on its own virtual clock.
+     *
+     * @param now Monotonic time in milliseconds.
+     */
+    void update(unsigned long now);
+
     /**
      * @brief Manually sets the irrigation mode.
      * 
@@ -71,7 +152,46 @@ class SmartIrrigationController {
      * 
      * @param newMode A string specifying the new irrigation mode ("AUTO" or "MANUAL").
      */
-    void setMode(String newMode);
+    void setMode(const char* newMode);
+
+    /**
+     * @brief Prints a per-component static RAM usage report as JSON.
+     *
+     * `total` is the whole controller; the other fields split it into its member
+     * components and `controllerOverhead` (remaining fields and padding), so they
+     * add up to `total`.
+     */
+    void printMemoryReport();
+
+    /**
+     * @brief Returns the active configuration record.
+     *
+     * Copy it, edit the copy, call sealDeviceConfig() and pass it to applyConfig().
+     */
+    const DeviceConfig& getConfig() const;
+
+    /**
+     * @brief Validates and atomically activates a binary configuration record.
+     *
+     * Intended for the command path. The blob is copied into the inactive slot,
+     * checked in place (header, CRC, ranges) and published with a single index swap;
+     * update() picks it up on its next call, including pin changes. If persistence
+     * is enabled, the record is then stored for the next boot. Only one command path
+     * may call this.
+     *
+     * @param blob Raw DeviceConfig bytes.
+     * @param length Size of the blob; must equal sizeof(DeviceConfig).
+     * @return CONFIG_APPLIED, CONFIG_REJECTED for an invalid record, or CONFIG_BUSY
+     *         if the previous swap has not yet been picked up by update().
+     */
+    ConfigApplyResult applyConfig(const uint8_t* blob, size_t length);
+
+    /**
+     * @brief Returns how long the last applyConfig() validate-and-swap took.
+     *
+     * @return Duration in microseconds, excluding persistence.
+     */
+    unsigned long getLastApplyMicros() const;
 };
 
 #endif // SMART_IRRIGATION_CONTROLLER_H
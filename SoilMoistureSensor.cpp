@@ -53,3 +53,23 @@ void SoilMoistureSensor::read() {
 float SoilMoistureSensor::getMoisturePercent() {
   return map(rawValue, 4095, 0, 0, 100); // dry = 4095, wet = 0
 }
+
+/**
+ * @brief Returns the GPIO pin currently assigned to the sensor.
+ *
+ * @return uint8_t Pin number.
+ */
+uint8_t SoilMoistureSensor::getPin() {
+  return pin;
+}
+
+/**
+ * @brief Reassigns the GPIO pin of the sensor.
+ *
+ * Takes effect on the next call to begin().
+ *
+ * @param newPin New GPIO pin.
+ */
+void SoilMoistureSensor::setPin(uint8_t newPin) {
+  pin = newPin;
+}
@@ -50,6 +50,22 @@ class SoilMoistureSensor {
      * @return float Soil moisture percentage.
      */
     float getMoisturePercent();
+
+    /**
+     * @brief Gets the GPIO pin currently assigned to the sensor.
+     *
+     * @return uint8_t Pin number.
+     */
+    uint8_t getPin();
+
+    /**
+     * @brief Reassigns the GPIO pin of the sensor.
+     *
+     * Call begin() afterwards to configure the new pin.
+     *
+     * @param newPin New GPIO pin.
+     */
+    void setPin(uint8_t newPin);
 };
 
 #endif // SOIL_MOISTURE_SENSOR_H
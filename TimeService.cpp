@@ -0,0 +1,252 @@
+/**
+ * @file TimeService.cpp
+ * @brief Implementation file for the TimeService class.
+ *
+ * Samples UTC through SNTP, keeps a monotonic-to-UTC offset with drift correction,
+ * and formats ISO-8601 timestamps by reusing the cached date prefix between reports.
+ *
+ * Project: Allpa Kawsay - IoT Agricultural Monitoring
+ *
+ * @author Sharon Antuanet Ivet Barrial Marin
+ * @code U202114900
+ */
+
+#include "TimeService.h"
+#include <sys/time.h>
+#ifdef ARDUINO
+#include <WiFi.h>
+#endif
+
+/// Earliest UTC accepted as synchronized (2020-01-01T00:00:00Z); older means the clock was never set.
+static const int64_t MIN_VALID_EPOCH_MS = 1577836800000LL;
+/// Milliseconds in one UTC day.
+static const int64_t MS_PER_DAY = 86400000LL;
+/// Retry period for UTC samples while not yet synchronized.
+static const unsigned long UNSYNCED_RETRY_MS = 2000UL;
+/// Minimum window between syncs used to estimate drift.
+static const unsigned long DRIFT_MIN_WINDOW_MS = 60000UL;
+/// Larger measured drifts are treated as clock steps and not learned.
+static const int32_t DRIFT_MAX_PPM = 500;
+
+/**
+ * @brief Samples UTC from the system clock.
+ *
+ * On the device the system clock is set by SNTP; samples are only trusted while WiFi
+ * is connected and the clock holds a plausible date. On a host build the local
+ * system clock stands in for SNTP.
+ *
+ * @param epochMs Receives milliseconds since epoch.
+ * @return true if the sample is valid.
+ */
+bool sntpEpochSource(int64_t& epochMs) {
+#ifdef ARDUINO
+  if (WiFi.status() != WL_CONNECTED) {
+    return false;
+  }
+#endif
+  struct timeval tv;
+  gettimeofday(&tv, nullptr);
+
+  int64_t sample = (int64_t)tv.tv_sec * 1000 + tv.tv_usec / 1000;
+  if (sample < MIN_VALID_EPOCH_MS) {
+    return false;
+  }
+  epochMs = sample;
+  return true;
+}
+
+/**
+ * @brief Writes a zero-padded decimal number of fixed width.
+ *
+ * @param out Destination (not terminated).
+ * @param value Number to write.
+ * @param width Number of digits to emit.
+ */
+static void writeDigits(char* out, uint32_t value, uint8_t width) {
+  for (int8_t i = width - 1; i >= 0; i--) {
+    out[i] = '0' + (value % 10);
+    value /= 10;
+  }
+}
+
+/**
+ * @brief Constructor for TimeService.
+ *
+ * @param source Function used to sample UTC.
+ * @param resyncIntervalMs Period between UTC samples once synchronized.
+ */
+TimeService::TimeService(EpochSource source, unsigned long resyncIntervalMs)
+  : source(source), resyncInterval(resyncIntervalMs), synced(false), syncEpochMs(0),
+    syncSampleMs(0), lastEpochMs(0), syncMonotonicMs(0), lastAttemptMs(0), driftPpm(0), dayStartMs(-1) {
+  buffer[0] = '\0';
+}
+
+/**
+ * @brief Starts SNTP on the device (UTC, no daylight saving offset).
+ *
+ * The SNTP client keeps retrying in the background, so it can be started before
+ * WiFi is connected.
+ *
+ * @param server NTP server host name.
+ */
+void TimeService::begin(const char* server) {
+#ifdef ARDUINO
+  configTime(0, 0, server);
+#else
+  (void)server;
+#endif
+}
+
+/**
+ * @brief Samples UTC when due and refreshes the offset.
+ *
+ * On each resync, the difference between the predicted and sampled UTC over the
+ * elapsed window updates the drift estimate (averaged with the previous one).
+ * If the sample lies behind a timestamp already handed out, the mapping is
+ * anchored at that timestamp instead, so report times stay non-decreasing; the
+ * remaining error is absorbed by later resyncs.
+ *
+ * @param nowMs Current monotonic time in milliseconds.
+ */
+void TimeService::update(unsigned long nowMs) {
+  unsigned long interval = synced ? resyncInterval : UNSYNCED_RETRY_MS;
+  if (nowMs - lastAttemptMs < interval) {
+    return;
+  }
+  lastAttemptMs = nowMs;
+
+  int64_t sample;
+  if (!source(sample)) {
+    return;
+  }
+
+  if (synced) {
+    unsigned long elapsed = nowMs - syncMonotonicMs;
+    if (elapsed >= DRIFT_MIN_WINDOW_MS) {
+      int64_t error = sample - (syncSampleMs + (int64_t)elapsed);
+      int64_t measured = error * 1000000 / (int64_t)elapsed;
+      if (measured >= -DRIFT_MAX_PPM && measured <= DRIFT_MAX_PPM) {
+        driftPpm = (driftPpm + (int32_t)measured) / 2;
+      }
+    }
+  }
+
+  syncSampleMs = sample;
+  syncEpochMs = sample < lastEpochMs ? lastEpochMs : sample;
+  syncMonotonicMs = nowMs;
+  synced = true;
+}
+
+/**
+ * @brief Indicates whether a UTC sync has happened.
+ *
+ * @return true once the first valid sample has been taken.
+ */
+bool TimeService::isSynced() const {
+  return synced;
+}
+
+/**
+ * @brief Converts a monotonic time into UTC milliseconds since epoch.
+ *
+ * Elapsed time since the last sync is computed with unsigned arithmetic, so
+ * `millis()` rollover between syncs is handled.
+ *
+ * @param nowMs Monotonic time in milliseconds.
+ * @return UTC epoch milliseconds, never below a previously returned value,
+ *         or -1 if not yet synchronized.
+ */
+int64_t TimeService::epochMs(unsigned long nowMs) const {
+  if (!synced) {
+    return -1;
+  }
+  int64_t elapsed = (int64_t)(unsigned long)(nowMs - syncMonotonicMs);
+  int64_t value = syncEpochMs + elapsed + elapsed * driftPpm / 1000000;
+  if (value < lastEpochMs) {
+    value = lastEpochMs;
+  }
+  lastEpochMs = value;
+  return value;
+}
+
+/**
+ * @brief Rebuilds the "YYYY-MM-DDT" prefix and the fixed separators of the buffer.
+ *
+ * Converts days since epoch to a civil date with integer arithmetic
+ * (proleptic Gregorian calendar).
+ *
+ * @param epochMs UTC time within the day to cache.
+ */
+void TimeService::cacheDate(int64_t epochMs) {
+  int32_t days = (int32_t)(epochMs / MS_PER_DAY);
+  dayStartMs = (int64_t)days * MS_PER_DAY;
+
+  int32_t z = days + 719468;
+  int32_t era = z / 146097;
+  uint32_t dayOfEra = (uint32_t)(z - era * 146097);
+  uint32_t yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+  uint32_t dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+  uint32_t mp = (5 * dayOfYear + 2) / 153;
+  uint32_t day = dayOfYear - (153 * mp + 2) / 5 + 1;
+  uint32_t month = mp < 10 ? mp + 3 : mp - 9;
+  uint32_t year = yearOfEra + era * 400 + (month <= 2 ? 1 : 0);
+
+  writeDigits(buffer, year, 4);
+  buffer[4] = '-';
+  writeDigits(buffer + 5, month, 2);
+  buffer[7] = '-';
+  writeDigits(buffer + 8, day, 2);
+  buffer[10] = 'T';
+  buffer[13] = ':';
+  buffer[16] = ':';
+  buffer[19] = '.';
+  buffer[23] = 'Z';
+  buffer[24] = '\0';
+}
+
+/**
+ * @brief Formats a timestamp for the given monotonic time.
+ *
+ * When synchronized, only the time-of-day digits are rewritten unless the UTC date
+ * changed since the previous call. Otherwise the uptime is written as an ISO-8601
+ * duration.
+ *
+ * @param nowMs Monotonic time in milliseconds.
+ * @return Null-terminated timestamp owned by the service.
+ */
+const char* TimeService::format(unsigned long nowMs) {
+  if (!synced) {
+    char digits[10];
+    uint8_t count = 0;
+    unsigned long seconds = nowMs / 1000;
+    do {
+      digits[count++] = '0' + (seconds % 10);
+      seconds /= 10;
+    } while (seconds > 0);
+
+    uint8_t pos = 0;
+    buffer[pos++] = 'P';
+    buffer[pos++] = 'T';
+    while (count > 0) {
+      buffer[pos++] = digits[--count];
+    }
+    buffer[pos++] = '.';
+    writeDigits(buffer + pos, nowMs % 1000, 3);
+    pos += 3;
+    buffer[pos++] = 'S';
+    buffer[pos] = '\0';
+    return buffer;
+  }
+
+  int64_t now = epochMs(nowMs);
+  if (dayStartMs < 0 || now < dayStartMs || now >= dayStartMs + MS_PER_DAY) {
+    cacheDate(now);
+  }
+
+  uint32_t msOfDay = (uint32_t)(now - dayStartMs);
+  writeDigits(buffer + 11, msOfDay / 3600000, 2);
+  writeDigits(buffer + 14, (msOfDay / 60000) % 60, 2);
+  writeDigits(buffer + 17, (msOfDay / 1000) % 60, 2);
+  writeDigits(buffer + 20, msOfDay % 1000, 3);
+  return buffer;
+}
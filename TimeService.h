@@ -0,0 +1,120 @@
+/**
+ * @file TimeService.h
+ * @brief Header file for the TimeService class.
+ *
+ * Keeps wall-clock time for the Allpa Kawsay IoT device. The service samples UTC
+ * through SNTP when the network is connected, stores it as an offset from the
+ * monotonic millisecond clock with drift correction, and formats report timestamps
+ * incrementally without calling `strftime`.
+ *
+ * Project: Allpa Kawsay - IoT Agricultural Monitoring
+ * Platform: ESP32 + ModestIoT
+ *
+ * @author Sharon Antuanet Ivet Barrial Marin
+ * @code U202114900
+ */
+
+#ifndef TIME_SERVICE_H
+#define TIME_SERVICE_H
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#else
+#include <stdint.h>
+#endif
+
+/// Capacity of the timestamp buffer ("YYYY-MM-DDTHH:MM:SS.mmmZ" plus terminator).
+#define TIMESTAMP_CAPACITY 25
+
+/**
+ * @brief Function that samples the current UTC time.
+ *
+ * @param epochMs Receives milliseconds since 1970-01-01T00:00:00Z.
+ * @return true if the sample is valid (clock synchronized), false otherwise.
+ */
+typedef bool (*EpochSource)(int64_t& epochMs);
+
+/**
+ * @brief Default UTC source.
+ *
+ * On the device it reads the system clock once SNTP has set it and WiFi is connected.
+ * On a host build it reads the local system clock as a stand-in.
+ */
+bool sntpEpochSource(int64_t& epochMs);
+
+/**
+ * @class TimeService
+ * @brief Maps the monotonic millisecond clock to UTC and formats report timestamps.
+ *
+ * Before the first successful sync, timestamps fall back to uptime-relative
+ * ISO-8601 durations (e.g. "PT12.345S"). Once synced, timestamps never go
+ * backwards, even when a resync finds the local clock ran fast.
+ */
+class TimeService {
+  private:
+    EpochSource source;             ///< UTC sample provider.
+    unsigned long resyncInterval;   ///< Period between SNTP samples once synced (ms).
+    bool synced;                    ///< True after the first valid UTC sample.
+    int64_t syncEpochMs;            ///< UTC mapped to the last sync, never below a returned value (ms).
+    int64_t syncSampleMs;           ///< Raw UTC sample of the last sync, used for drift estimation (ms).
+    mutable int64_t lastEpochMs;    ///< Highest UTC value returned so far (ms).
+    unsigned long syncMonotonicMs;  ///< Monotonic clock at the last sync (ms).
+    unsigned long lastAttemptMs;    ///< Monotonic clock at the last sample attempt (ms).
+    int32_t driftPpm;               ///< Learned drift of the monotonic clock against UTC (ppm).
+    int64_t dayStartMs;             ///< UTC midnight of the cached date prefix, -1 if none.
+    char buffer[TIMESTAMP_CAPACITY]; ///< Last formatted timestamp; date prefix reused across calls.
+
+    /**
+     * @brief Rebuilds the cached "YYYY-MM-DDT" prefix for the day containing the given time.
+     */
+    void cacheDate(int64_t epochMs);
+
+  public:
+    /**
+     * @brief Constructor for TimeService.
+     *
+     * @param source Function used to sample UTC (defaults to SNTP).
+     * @param resyncIntervalMs Period between UTC samples once synchronized.
+     */
+    TimeService(EpochSource source = sntpEpochSource, unsigned long resyncIntervalMs = 3600000UL);
+
+    /**
+     * @brief Starts SNTP on the device.
+     *
+     * @param server NTP server host name.
+     */
+    void begin(const char* server = "pool.ntp.org");
+
+    /**
+     * @brief Samples UTC when due and updates the offset and drift estimate.
+     *
+     * @param nowMs Current monotonic time in milliseconds.
+     */
+    void update(unsigned long nowMs);
+
+    /**
+     * @brief Indicates whether a UTC sync has happened.
+     */
+    bool isSynced() const;
+
+    /**
+     * @brief Converts a monotonic time into UTC milliseconds since epoch.
+     *
+     * @param nowMs Monotonic time in milliseconds.
+     * @return UTC epoch milliseconds, or -1 if not yet synchronized.
+     */
+    int64_t epochMs(unsigned long nowMs) const;
+
+    /**
+     * @brief Formats a timestamp for the given monotonic time.
+     *
+     * Produces "YYYY-MM-DDTHH:MM:SS.mmmZ" when synchronized and "PT<s>.<ms>S" otherwise.
+     * The returned buffer is owned by the service and overwritten by the next call.
+     *
+     * @param nowMs Monotonic time in milliseconds.
+     * @return Null-terminated timestamp string.
+     */
+    const char* format(unsigned long nowMs);
+};
+
+#endif // TIME_SERVICE_H
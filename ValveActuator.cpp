@@ -47,3 +47,23 @@ void ValveActuator::open() {
 void ValveActuator::close() {
   digitalWrite(pin, LOW);
 }
+
+/**
+ * @brief Returns the GPIO pin currently assigned to the valve relay.
+ *
+ * @return uint8_t Pin number.
+ */
+uint8_t ValveActuator::getPin() {
+  return pin;
+}
+
+/**
+ * @brief Reassigns the GPIO pin of the valve relay.
+ *
+ * Takes effect on the next call to begin().
+ *
+ * @param newPin New GPIO pin.
+ */
+void ValveActuator::setPin(uint8_t newPin) {
+  pin = newPin;
+}
@@ -45,6 +45,22 @@ class ValveActuator {
      * @brief Closes the valve by setting the pin LOW.
      */
     void close();
+
+    /**
+     * @brief Gets the GPIO pin currently assigned to the valve relay.
+     *
+     * @return uint8_t Pin number.
+     */
+    uint8_t getPin();
+
+    /**
+     * @brief Reassigns the GPIO pin of the valve relay.
+     *
+     * Call begin() afterwards to configure the new pin.
+     *
+     * @param newPin New GPIO pin.
+     */
+    void setPin(uint8_t newPin);
 };
 
 #endif // VALVE_ACTUATOR_H
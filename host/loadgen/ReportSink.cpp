@@ -0,0 +1,123 @@
+/**
+ * @file ReportSink.cpp
+ * @brief Implementation of the report sinks used by the load generator.
+ *
+ * Project: Allpa Kawsay - IoT Agricultural Monitoring
+ * Platform: Host (Linux/macOS) simulation
+ *
+ * @author Sharon Antuanet Ivet Barrial Marin
+ * @code U202114900
+ */
+
+#include "ReportSink.h"
+#include <arpa/inet.h>
+#include <mutex>
+#include <netinet/in.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+ReportSink::ReportSink() : lineCount(0), byteCount(0) {}
+
+void ReportSink::submit(const char* line, size_t length) {
+  lineCount.fetch_add(1, std::memory_order_relaxed);
+  byteCount.fetch_add(length, std::memory_order_relaxed);
+  deliver(line, length);
+}
+
+uint64_t ReportSink::lines() const {
+  return lineCount.load();
+}
+
+uint64_t ReportSink::bytes() const {
+  return byteCount.load();
+}
+
+void NullSink::deliver(const char* line, size_t length) {
+  (void)line;
+  (void)length;
+}
+
+ConsumerSink::ConsumerSink(std::function<void(const char*, size_t)> consumer)
+  : consumer(std::move(consumer)) {}
+
+void ConsumerSink::deliver(const char* line, size_t length) {
+  consumer(line, length);
+}
+
+/// Open file plus the mutex serializing writers.
+struct FileSink::Impl {
+  FILE* file;
+  std::mutex mutex;
+};
+
+FileSink::FileSink(const std::string& path) : impl(new Impl()) {
+  impl->file = fopen(path.c_str(), "w");
+}
+
+FileSink::~FileSink() {
+  if (impl->file != nullptr) {
+    fclose(impl->file);
+  }
+}
+
+bool FileSink::isOpen() const {
+  return impl->file != nullptr;
+}
+
+void FileSink::deliver(const char* line, size_t length) {
+  std::lock_guard<std::mutex> lock(impl->mutex);
+  fwrite(line, 1, length, impl->file);
+  fputc('\n', impl->file);
+}
+
+void FileSink::flush() {
+  std::lock_guard<std::mutex> lock(impl->mutex);
+  fflush(impl->file);
+}
+
+UdpSink::UdpSink(uint16_t port) : socketFd(socket(AF_INET, SOCK_DGRAM, 0)), port(port) {}
+
+UdpSink::~UdpSink() {
+  if (socketFd >= 0) {
+    close(socketFd);
+  }
+}
+
+bool UdpSink::isOpen() const {
+  return socketFd >= 0;
+}
+
+/**
+ * @brief Sends one datagram per line; sendto() is thread-safe, so no lock is taken.
+ *
+ * Datagrams nobody listens for are dropped by the kernel, which is acceptable
+ * for load generation.
+ */
+void UdpSink::deliver(const char* line, size_t length) {
+  sockaddr_in target = {};
+  target.sin_family = AF_INET;
+  target.sin_port = htons(port);
+  target.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  sendto(socketFd, line, length, 0, reinterpret_cast<const sockaddr*>(&target), sizeof(target));
+}
+
+std::unique_ptr<ReportSink> makeReportSink(const std::string& spec) {
+  if (spec == "null") {
+    return std::unique_ptr<ReportSink>(new NullSink());
+  }
+  if (spec.compare(0, 5, "file:") == 0 && spec.size() > 5) {
+    std::unique_ptr<FileSink> sink(new FileSink(spec.substr(5)));
+    return sink->isOpen() ? std::move(sink) : nullptr;
+  }
+  if (spec.compare(0, 4, "udp:") == 0 && spec.size() > 4) {
+    long port = strtol(spec.c_str() + 4, nullptr, 10);
+    if (port <= 0 || port > 65535) {
+      return nullptr;
+    }
+    std::unique_ptr<UdpSink> sink(new UdpSink(static_cast<uint16_t>(port)));
+    return sink->isOpen() ? std::move(sink) : nullptr;
+  }
+  return nullptr;
+}
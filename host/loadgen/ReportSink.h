@@ -0,0 +1,135 @@
+/**
+ * @file ReportSink.h
+ * @brief Destinations for the report lines produced by simulated controllers.
+ *
+ * A sink receives complete lines from many worker threads at once. Available
+ * sinks discard (`null`), hand lines to an in-process consumer (`memory`), append
+ * to a file (`file:<path>`) or send one UDP datagram per line to a local port
+ * (`udp:<port>`).
+ *
+ * Project: Allpa Kawsay - IoT Agricultural Monitoring
+ * Platform: Host (Linux/macOS) simulation
+ *
+ * @author Sharon Antuanet Ivet Barrial Marin
+ * @code U202114900
+ */
+
+#ifndef REPORT_SINK_H
+#define REPORT_SINK_H
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+
+/**
+ * @class ReportSink
+ * @brief Thread-safe consumer of report lines.
+ */
+class ReportSink {
+  private:
+    std::atomic<uint64_t> lineCount;  ///< Lines submitted so far.
+    std::atomic<uint64_t> byteCount;  ///< Bytes submitted so far (without line terminators).
+
+  protected:
+    /**
+     * @brief Delivers one line to the destination. Called concurrently.
+     */
+    virtual void deliver(const char* line, size_t length) = 0;
+
+  public:
+    ReportSink();
+    virtual ~ReportSink() {}
+
+    /**
+     * @brief Counts and delivers one line (without its terminator).
+     */
+    void submit(const char* line, size_t length);
+
+    /**
+     * @brief Flushes buffered output, if any.
+     */
+    virtual void flush() {}
+
+    uint64_t lines() const;
+    uint64_t bytes() const;
+};
+
+/**
+ * @class NullSink
+ * @brief Counts lines and discards them.
+ */
+class NullSink : public ReportSink {
+  protected:
+    void deliver(const char* line, size_t length) override;
+};
+
+/**
+ * @class ConsumerSink
+ * @brief Hands every line to an in-process consumer function.
+ *
+ * The consumer is called from worker threads and must be thread-safe.
+ */
+class ConsumerSink : public ReportSink {
+  private:
+    std::function<void(const char*, size_t)> consumer;  ///< Line consumer.
+
+  protected:
+    void deliver(const char* line, size_t length) override;
+
+  public:
+    explicit ConsumerSink(std::function<void(const char*, size_t)> consumer);
+};
+
+/**
+ * @class FileSink
+ * @brief Appends lines to a file, serialized by a mutex.
+ */
+class FileSink : public ReportSink {
+  private:
+    struct Impl;
+    std::unique_ptr<Impl> impl;  ///< Open file and its lock.
+
+  protected:
+    void deliver(const char* line, size_t length) override;
+
+  public:
+    explicit FileSink(const std::string& path);
+    ~FileSink() override;
+
+    bool isOpen() const;
+    void flush() override;
+};
+
+/**
+ * @class UdpSink
+ * @brief Sends each line as one datagram to 127.0.0.1:<port>.
+ */
+class UdpSink : public ReportSink {
+  private:
+    int socketFd;          ///< Datagram socket, -1 if it could not be created.
+    uint16_t port;         ///< Destination port on the loopback interface.
+
+  protected:
+    void deliver(const char* line, size_t length) override;
+
+  public:
+    explicit UdpSink(uint16_t port);
+    ~UdpSink() override;
+
+    bool isOpen() const;
+};
+
+/**
+ * @brief Creates a sink from a command-line specification.
+ *
+ * @param spec "null", "file:<path>" or "udp:<port>". The in-process sink is
+ *             created directly by the caller, since it needs a consumer.
+ * @return The sink, or nullptr if the specification is invalid or the
+ *         destination cannot be opened.
+ */
+std::unique_ptr<ReportSink> makeReportSink(const std::string& spec);
+
+#endif // REPORT_SINK_H
@@ -0,0 +1,114 @@
+/**
+ * @file SimulatedNode.cpp
+ * @brief Implementation of the simulated irrigation node.
+ *
+ * Project: Allpa Kawsay - IoT Agricultural Monitoring
+ * Platform: Host (Linux/macOS) simulation
+ *
+ * @author Sharon Antuanet Ivet Barrial Marin
+ * @code U202114900
+ */
+
+#include "SimulatedNode.h"
+#include <stdio.h>
+
+/// UTC at virtual time zero (2026-01-01T00:00:00Z).
+static const int64_t SIMULATION_EPOCH_MS = 1767225600000LL;
+/// Virtual time before a node's first SNTP sync succeeds.
+static const unsigned long SIMULATED_SNTP_DELAY_MS = 3000UL;
+/// Seconds per simulated day.
+static const float SECONDS_PER_DAY = 86400.0f;
+
+/**
+ * @brief Simulated SNTP for the node whose board is selected on this thread.
+ *
+ * UTC follows the node's virtual clock, so each node has its own wall time
+ * regardless of which thread steps it.
+ */
+static bool virtualEpochSource(int64_t& epochMs) {
+  const VirtualHal& hal = currentHal();
+  if (hal.nowMs < SIMULATED_SNTP_DELAY_MS) {
+    return false;
+  }
+  epochMs = SIMULATION_EPOCH_MS + hal.nowMs;
+  return true;
+}
+
+/**
+ * @brief Deterministic pseudo-random value in [0, 1) for a node and channel.
+ */
+static float nodeRandom(uint32_t id, uint32_t channel) {
+  uint32_t x = id * 0x9E3779B1u ^ channel * 0x85EBCA77u;
+  x ^= x >> 15;
+  x *= 0x2C1B3C6Du;
+  x ^= x >> 12;
+  x *= 0x297A2D39u;
+  x ^= x >> 15;
+  return (x >> 8) / 16777216.0f;
+}
+
+SinkPrint::SinkPrint(ReportSink& sink) : sink(sink), length(0) {}
+
+/**
+ * @brief Buffers one byte; a newline (or a full buffer) submits the line.
+ *
+ * Carriage returns from println() are dropped.
+ */
+size_t SinkPrint::write(uint8_t c) {
+  if (c == '\r') {
+    return 1;
+  }
+  if (c == '\n' || length == NODE_LINE_CAPACITY) {
+    sink.submit(line, length);
+    length = 0;
+    if (c == '\n') {
+      return 1;
+    }
+  }
+  line[length++] = static_cast<char>(c);
+  return 1;
+}
+
+void SoilModel::step(VirtualHal& hal, const DeviceConfig& config, float seconds) {
+  float dayPhase = 2.0f * static_cast<float>(M_PI) * (hal.nowMs / 1000.0f) / SECONDS_PER_DAY;
+  hal.temperature = baseTemperature + 8.0f * sinf(dayPhase);
+  hal.humidity = 60.0f - 20.0f * sinf(dayPhase);
+
+  bool valveOpen = config.valvePin < VIRTUAL_HAL_PINS && hal.digital[config.valvePin] == HIGH;
+  float drying = dryingPerSecond * (1.0f + (hal.temperature - 20.0f) / 20.0f);
+  moisture += ((valveOpen ? wettingPerSecond : 0.0f) - drying) * seconds;
+  moisture = moisture < 0.0f ? 0.0f : (moisture > 100.0f ? 100.0f : moisture);
+
+  if (config.soilPin < VIRTUAL_HAL_PINS) {
+    hal.analog[config.soilPin] = static_cast<uint16_t>(4095.0f - moisture * 40.95f);
+  }
+}
+
+SimulatedNode::MacAddress::MacAddress(uint32_t id) {
+  snprintf(text, sizeof(text), "02:00:%02X:%02X:%02X:%02X",
+           (unsigned)(id >> 24) & 0xFF, (unsigned)(id >> 16) & 0xFF,
+           (unsigned)(id >> 8) & 0xFF, (unsigned)id & 0xFF);
+}
+
+SimulatedNode::SimulatedNode(uint32_t id, ReportSink& sink)
+  : hal(), mac(id), out(sink), controller(mac.text, out, nullptr, "", virtualEpochSource) {
+  soil.moisture = 20.0f + 50.0f * nodeRandom(id, 0);
+  soil.wettingPerSecond = 0.5f + 1.0f * nodeRandom(id, 1);
+  soil.dryingPerSecond = 0.05f + 0.1f * nodeRandom(id, 2);
+  soil.baseTemperature = 15.0f + 10.0f * nodeRandom(id, 3);
+}
+
+void SimulatedNode::begin() {
+  selectHal(&hal);
+  controller.begin();
+  soil.step(hal, controller.getConfig(), 0.0f);
+  selectHal(nullptr);
+}
+
+void SimulatedNode::step(unsigned long stepMs) {
+  selectHal(&hal);
+  hal.nowMs += stepMs;
+  soil.step(hal, controller.getConfig(), stepMs / 1000.0f);
+  controller.update(hal.nowMs);
+  selectHal(nullptr);
+}
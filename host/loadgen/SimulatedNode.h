@@ -0,0 +1,103 @@
+/**
+ * @file SimulatedNode.h
+ * @brief One simulated irrigation node: controller, virtual board and soil model.
+ *
+ * Each node owns its VirtualHal, a soil/weather model feeding it, and a
+ * SmartIrrigationController whose reports go to a shared ReportSink. Nodes share
+ * no mutable state, so any thread may step any node.
+ *
+ * Project: Allpa Kawsay - IoT Agricultural Monitoring
+ * Platform: Host (Linux/macOS) simulation
+ *
+ * @author Sharon Antuanet Ivet Barrial Marin
+ * @code U202114900
+ */
+
+#ifndef SIMULATED_NODE_H
+#define SIMULATED_NODE_H
+
+#include <Arduino.h>
+#include "ReportSink.h"
+#include "SmartIrrigationController.h"
+#include "VirtualHal.h"
+
+/// Longest report line kept by a node before it is flushed to the sink.
+#define NODE_LINE_CAPACITY 256
+
+/**
+ * @class SinkPrint
+ * @brief Print adapter that assembles lines and submits them to a ReportSink.
+ */
+class SinkPrint : public Print {
+  private:
+    ReportSink& sink;                ///< Shared destination.
+    char line[NODE_LINE_CAPACITY];   ///< Line under construction.
+    size_t length;                   ///< Bytes in `line`.
+
+  public:
+    explicit SinkPrint(ReportSink& sink);
+    size_t write(uint8_t c) override;
+    using Print::write;
+};
+
+/**
+ * @struct SoilModel
+ * @brief Bucket model of soil moisture and a diurnal weather cycle.
+ */
+struct SoilModel {
+  float moisture;           ///< Soil moisture (%).
+  float wettingPerSecond;   ///< Moisture gained per second while the valve is open (%).
+  float dryingPerSecond;    ///< Moisture lost per second at 20 °C (%).
+  float baseTemperature;    ///< Daily mean temperature (°C).
+
+  /**
+   * @brief Advances the model and writes sensor values into the board.
+   *
+   * @param hal Board to read the valve from and write sensors to.
+   * @param config Active controller config (pin assignment).
+   * @param seconds Simulated time step.
+   */
+  void step(VirtualHal& hal, const DeviceConfig& config, float seconds);
+};
+
+/**
+ * @class SimulatedNode
+ * @brief A controller instance with its own board, clock, weather and UTC offset.
+ */
+class SimulatedNode {
+  private:
+    /// MAC text built before the controller copies it.
+    struct MacAddress {
+      char text[MAC_ADDRESS_CAPACITY];
+      explicit MacAddress(uint32_t id);
+    };
+
+    VirtualHal hal;                        ///< This node's board.
+    SoilModel soil;                        ///< This node's field.
+    MacAddress mac;                        ///< Node MAC derived from its id.
+    SinkPrint out;                         ///< Report stream into the shared sink.
+    SmartIrrigationController controller;  ///< Controller under load.
+
+  public:
+    /**
+     * @brief Creates a node with a deterministic, id-seeded soil and weather profile.
+     *
+     * @param id Node index, also encoded in the MAC address.
+     * @param sink Destination for this node's report lines.
+     */
+    SimulatedNode(uint32_t id, ReportSink& sink);
+
+    /**
+     * @brief Runs controller.begin() on this node's board.
+     */
+    void begin();
+
+    /**
+     * @brief Advances the virtual clock and field, then runs one controller update.
+     *
+     * @param stepMs Virtual time step in milliseconds.
+     */
+    void step(unsigned long stepMs);
+};
+
+#endif // SIMULATED_NODE_H
@@ -0,0 +1,139 @@
+/**
+ * @file WorkStealingPool.cpp
+ * @brief Implementation of the work-stealing thread pool.
+ *
+ * Project: Allpa Kawsay - IoT Agricultural Monitoring
+ * Platform: Host (Linux/macOS) simulation
+ *
+ * @author Sharon Antuanet Ivet Barrial Marin
+ * @code U202114900
+ */
+
+#include "WorkStealingPool.h"
+
+WorkStealingPool::WorkStealingPool(size_t threads)
+  : batch(0), active(0), stopping(false), task(nullptr), pending(0), stealCount(0) {
+  if (threads == 0) {
+    threads = 1;
+  }
+  for (size_t i = 0; i < threads; i++) {
+    queues.emplace_back(new Queue());
+  }
+  for (size_t i = 0; i < threads; i++) {
+    workers.emplace_back(&WorkStealingPool::run, this, i);
+  }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+  {
+    std::lock_guard<std::mutex> lock(stateMutex);
+    stopping = true;
+  }
+  batchReady.notify_all();
+  for (std::thread& worker : workers) {
+    worker.join();
+  }
+}
+
+/**
+ * @brief Takes the newest task of the worker's own queue (LIFO keeps caches warm).
+ */
+bool WorkStealingPool::popLocal(size_t worker, size_t& item) {
+  Queue& queue = *queues[worker];
+  std::lock_guard<std::mutex> lock(queue.mutex);
+  if (queue.head == queue.items.size()) {
+    return false;
+  }
+  item = queue.items.back();
+  queue.items.pop_back();
+  return true;
+}
+
+/**
+ * @brief Takes the oldest task from another worker's queue, starting with the next one.
+ */
+bool WorkStealingPool::steal(size_t thief, size_t& item) {
+  for (size_t offset = 1; offset < queues.size(); offset++) {
+    Queue& queue = *queues[(thief + offset) % queues.size()];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.head < queue.items.size()) {
+      item = queue.items[queue.head++];
+      stealCount.fetch_add(1, std::memory_order_relaxed);
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * @brief Worker loop: wait for a batch, drain own queue, then steal until the batch is done.
+ *
+ * A worker counts itself in `active` while draining; the caller of parallelFor()
+ * waits for that count to drop to zero, so a worker that still sees the old
+ * `pending` value can never pop items of the next batch.
+ */
+void WorkStealingPool::run(size_t worker) {
+  uint64_t seen = 0;
+
+  for (;;) {
+    {
+      std::unique_lock<std::mutex> lock(stateMutex);
+      batchReady.wait(lock, [&] { return stopping || batch != seen; });
+      if (stopping) {
+        return;
+      }
+      seen = batch;
+      active++;
+    }
+
+    size_t item;
+    while (pending.load(std::memory_order_acquire) > 0) {
+      if (popLocal(worker, item) || steal(worker, item)) {
+        (*task)(item);
+        if (pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+          std::lock_guard<std::mutex> lock(stateMutex);
+          batchDone.notify_all();
+        }
+      } else {
+        std::this_thread::yield();
+      }
+    }
+
+    std::lock_guard<std::mutex> lock(stateMutex);
+    if (--active == 0) {
+      batchDone.notify_all();
+    }
+  }
+}
+
+void WorkStealingPool::parallelFor(size_t count, const std::function<void(size_t)>& body) {
+  if (count == 0) {
+    return;
+  }
+
+  for (std::unique_ptr<Queue>& queue : queues) {
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    queue->items.clear();
+    queue->head = 0;
+  }
+  for (size_t i = 0; i < count; i++) {
+    Queue& queue = *queues[i % queues.size()];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    queue.items.push_back(i);
+  }
+
+  std::unique_lock<std::mutex> lock(stateMutex);
+  task = &body;
+  pending.store(count, std::memory_order_release);
+  batch++;
+  batchReady.notify_all();
+  batchDone.wait(lock, [&] { return pending.load(std::memory_order_acquire) == 0 && active == 0; });
+}
+
+uint64_t WorkStealingPool::steals() const {
+  return stealCount.load();
+}
+
+size_t WorkStealingPool::size() const {
+  return workers.size();
+}
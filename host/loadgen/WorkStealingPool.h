@@ -0,0 +1,93 @@
+/**
+ * @file WorkStealingPool.h
+ * @brief Fixed-size thread pool with per-worker queues and work stealing.
+ *
+ * parallelFor() deals task indices round-robin into the workers' queues. Each
+ * worker pops from the back of its own queue and, once empty, steals from the
+ * front of the others', so uneven chunks still keep every core busy.
+ *
+ * Project: Allpa Kawsay - IoT Agricultural Monitoring
+ * Platform: Host (Linux/macOS) simulation
+ *
+ * @author Sharon Antuanet Ivet Barrial Marin
+ * @code U202114900
+ */
+
+#ifndef WORK_STEALING_POOL_H
+#define WORK_STEALING_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stddef.h>
+#include <stdint.h>
+#include <thread>
+#include <vector>
+
+/**
+ * @class WorkStealingPool
+ * @brief Runs batches of independent tasks on a fixed set of worker threads.
+ */
+class WorkStealingPool {
+  private:
+    /// Task queue owned by one worker; the owner pops at `tail`, thieves take at `head`.
+    struct Queue {
+      std::mutex mutex;
+      std::vector<size_t> items;
+      size_t head = 0;
+    };
+
+    std::vector<std::unique_ptr<Queue>> queues;  ///< One queue per worker.
+    std::vector<std::thread> workers;            ///< Worker threads.
+    std::mutex stateMutex;                       ///< Guards batch start/stop signalling.
+    std::condition_variable batchReady;          ///< Wakes workers for a new batch.
+    std::condition_variable batchDone;           ///< Wakes the caller when a batch completes.
+    uint64_t batch;                              ///< Incremented for every batch.
+    size_t active;                               ///< Workers inside a drain loop; guarded by stateMutex.
+    bool stopping;                               ///< Set by the destructor.
+    const std::function<void(size_t)>* task;     ///< Body of the current batch.
+    std::atomic<size_t> pending;                 ///< Tasks of the current batch not yet finished.
+    std::atomic<uint64_t> stealCount;            ///< Tasks executed by a worker other than their owner.
+
+    bool popLocal(size_t worker, size_t& item);
+    bool steal(size_t thief, size_t& item);
+    void run(size_t worker);
+
+  public:
+    /**
+     * @brief Starts the worker threads.
+     *
+     * @param threads Number of workers (at least 1).
+     */
+    explicit WorkStealingPool(size_t threads);
+
+    /**
+     * @brief Stops and joins all workers.
+     */
+    ~WorkStealingPool();
+
+    /**
+     * @brief Runs body(i) for every i in [0, count) and waits for completion.
+     *
+     * Returns only once every task finished and every worker has left its drain
+     * loop, so no worker can carry over into the next batch with a stale body.
+     *
+     * @param count Number of tasks.
+     * @param body Task body; called concurrently from worker threads.
+     */
+    void parallelFor(size_t count, const std::function<void(size_t)>& body);
+
+    /**
+     * @brief Returns how many tasks were stolen since construction.
+     */
+    uint64_t steals() const;
+
+    /**
+     * @brief Returns the number of worker threads.
+     */
+    size_t size() const;
+};
+
+#endif // WORK_STEALING_POOL_H
@@ -0,0 +1,204 @@
+/**
+ * @file main.cpp
+ * @brief Fleet load generator for the Allpa Kawsay backend.
+ *
+ * Creates thousands of SmartIrrigationController instances, each with its own
+ * virtual board, clock and soil model, and steps them on a work-stealing pool.
+ * The run is repeated for 1, 2, 4, ... threads up to the requested maximum and
+ * reports controller-ticks per second, speedup and scaling efficiency per core.
+ *
+ * Usage:
+ *   loadgen [--nodes N] [--ticks T] [--step-ms MS] [--threads MAX] [--chunk C]
+ *           [--sink null|memory|file:<path>|udp:<port>]
+ *
+ * Project: Allpa Kawsay - IoT Agricultural Monitoring
+ * Platform: Host (Linux/macOS) simulation
+ *
+ * @author Sharon Antuanet Ivet Barrial Marin
+ * @code U202114900
+ */
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <thread>
+#include <vector>
+#include "ReportSink.h"
+#include "SimulatedNode.h"
+#include "WorkStealingPool.h"
+
+/**
+ * @struct Options
+ * @brief Command-line settings.
+ */
+struct Options {
+  size_t nodes = 2000;          ///< Controllers per run.
+  size_t ticks = 600;           ///< update() calls per controller per run.
+  unsigned long stepMs = 100;   ///< Virtual time per tick (the sketch loop delay).
+  size_t threads = 0;           ///< Highest thread count (0 = hardware concurrency).
+  size_t chunk = 64;            ///< Nodes per pool task.
+  std::string sink = "null";    ///< Sink specification.
+};
+
+/**
+ * @struct RunResult
+ * @brief Measurements of one run.
+ */
+struct RunResult {
+  size_t threads;         ///< Worker threads used.
+  double seconds;         ///< Wall time spent stepping.
+  double ticksPerSecond;  ///< Controller updates per wall second.
+  uint64_t steals;        ///< Tasks stolen by the pool.
+};
+
+static void printUsage() {
+  fprintf(stderr,
+          "usage: loadgen [--nodes N] [--ticks T] [--step-ms MS] [--threads MAX] [--chunk C]\n"
+          "               [--sink null|memory|file:<path>|udp:<port>]\n");
+}
+
+/**
+ * @brief Parses the command line.
+ *
+ * @return false on an unknown flag or a missing/zero value.
+ */
+static bool parseOptions(int argc, char** argv, Options& options) {
+  for (int i = 1; i < argc; i++) {
+    const char* flag = argv[i];
+    if (i + 1 >= argc) {
+      return false;
+    }
+    const char* value = argv[++i];
+
+    if (strcmp(flag, "--sink") == 0) {
+      options.sink = value;
+      continue;
+    }
+
+    unsigned long number = strtoul(value, nullptr, 10);
+    if (number == 0) {
+      return false;
+    }
+    if (strcmp(flag, "--nodes") == 0) {
+      options.nodes = number;
+    } else if (strcmp(flag, "--ticks") == 0) {
+      options.ticks = number;
+    } else if (strcmp(flag, "--step-ms") == 0) {
+      options.stepMs = number;
+    } else if (strcmp(flag, "--threads") == 0) {
+      options.threads = number;
+    } else if (strcmp(flag, "--chunk") == 0) {
+      options.chunk = number;
+    } else {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Builds a fresh fleet, then times `ticks` lock-step ticks on `threads` workers.
+ *
+ * Construction and begin() are excluded from the measurement.
+ */
+static RunResult runFleet(const Options& options, size_t threads, ReportSink& sink) {
+  std::vector<std::unique_ptr<SimulatedNode>> nodes;
+  nodes.reserve(options.nodes);
+  for (size_t i = 0; i < options.nodes; i++) {
+    nodes.emplace_back(new SimulatedNode(static_cast<uint32_t>(i), sink));
+    nodes.back()->begin();
+  }
+
+  WorkStealingPool pool(threads);
+  size_t chunks = (options.nodes + options.chunk - 1) / options.chunk;
+  std::function<void(size_t)> stepChunk = [&](size_t chunk) {
+    size_t first = chunk * options.chunk;
+    size_t last = first + options.chunk < options.nodes ? first + options.chunk : options.nodes;
+    for (size_t i = first; i < last; i++) {
+      nodes[i]->step(options.stepMs);
+    }
+  };
+
+  auto start = std::chrono::steady_clock::now();
+  for (size_t tick = 0; tick < options.ticks; tick++) {
+    pool.parallelFor(chunks, stepChunk);
+  }
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  RunResult result;
+  result.threads = threads;
+  result.seconds = seconds;
+  result.ticksPerSecond = (double)options.nodes * options.ticks / seconds;
+  result.steals = pool.steals();
+  return result;
+}
+
+int main(int argc, char** argv) {
+  Options options;
+  if (!parseOptions(argc, argv, options)) {
+    printUsage();
+    return 2;
+  }
+  if (options.threads == 0) {
+    options.threads = std::thread::hardware_concurrency() > 0 ? std::thread::hardware_concurrency() : 1;
+  }
+
+  std::atomic<uint64_t> reports(0);
+  std::unique_ptr<ReportSink> sink;
+  if (options.sink == "memory") {
+    // In-process consumer: counts status reports among all lines.
+    sink.reset(new ConsumerSink([&reports](const char* line, size_t length) {
+      static const char prefix[] = "{\"deviceMacAddress\":";
+      if (length > sizeof(prefix) - 1 && memcmp(line, prefix, sizeof(prefix) - 1) == 0) {
+        reports.fetch_add(1, std::memory_order_relaxed);
+      }
+    }));
+  } else {
+    sink = makeReportSink(options.sink);
+  }
+  if (!sink) {
+    fprintf(stderr, "loadgen: cannot open sink '%s'\n", options.sink.c_str());
+    return 2;
+  }
+
+  printf("nodes=%zu ticks=%zu step=%lums chunk=%zu sink=%s\n",
+         options.nodes, options.ticks, options.stepMs, options.chunk, options.sink.c_str());
+  printf("%8s %12s %18s %9s %11s %9s\n",
+         "threads", "seconds", "controller-ticks/s", "speedup", "efficiency", "steals");
+
+  std::vector<size_t> threadCounts;
+  for (size_t threads = 1; threads < options.threads; threads *= 2) {
+    threadCounts.push_back(threads);
+  }
+  threadCounts.push_back(options.threads);
+
+  double baseline = 0.0;
+  for (size_t threads : threadCounts) {
+    RunResult result = runFleet(options, threads, *sink);
+    if (baseline == 0.0) {
+      baseline = result.ticksPerSecond / result.threads;
+    }
+    double speedup = result.ticksPerSecond / baseline;
+    printf("%8zu %12.3f %18.0f %9.2f %10.1f%% %9llu\n", result.threads, result.seconds,
+           result.ticksPerSecond, speedup, 100.0 * speedup / result.threads,
+           (unsigned long long)result.steals);
+    fflush(stdout);
+  }
+
+  sink->flush();
+  printf("sink: %llu lines, %llu bytes\n", (unsigned long long)sink->lines(),
+         (unsigned long long)sink->bytes());
+
+  if (options.sink == "memory") {
+    printf("in-process consumer: %llu status reports\n", (unsigned long long)reports.load());
+    if (reports.load() == 0) {
+      fprintf(stderr, "loadgen: no status reports reached the consumer\n");
+      return 1;
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,179 @@
+/**
+ * @file Arduino.cpp
+ * @brief Implementation of the host Arduino shim.
+ *
+ * Project: Allpa Kawsay - IoT Agricultural Monitoring
+ * Platform: Host (Linux/macOS) simulation
+ *
+ * @author Sharon Antuanet Ivet Barrial Marin
+ * @code U202114900
+ */
+
+#include "Arduino.h"
+#include <chrono>
+#include <stdio.h>
+
+HardwareSerial Serial;
+
+static thread_local VirtualHal defaultHal = {};         ///< Board used when none is selected.
+static thread_local VirtualHal* selectedHal = nullptr;  ///< Board selected on this thread.
+
+VirtualHal& currentHal() {
+  return selectedHal != nullptr ? *selectedHal : defaultHal;
+}
+
+void selectHal(VirtualHal* hal) {
+  selectedHal = hal;
+}
+
+size_t Print::write(const uint8_t* buffer, size_t size) {
+  size_t written = 0;
+  while (size-- > 0) {
+    written += write(*buffer++);
+  }
+  return written;
+}
+
+size_t Print::write(const char* str) {
+  return str == nullptr ? 0 : write(reinterpret_cast<const uint8_t*>(str), strlen(str));
+}
+
+size_t Print::printNumber(unsigned long long n, uint8_t base) {
+  char digits[8 * sizeof(unsigned long long) + 1];
+  char* cursor = &digits[sizeof(digits) - 1];
+  *cursor = '\0';
+
+  if (base < 2) {
+    base = DEC;
+  }
+  do {
+    uint8_t digit = n % base;
+    *--cursor = digit < 10 ? '0' + digit : 'A' + digit - 10;
+    n /= base;
+  } while (n > 0);
+  return write(cursor);
+}
+
+size_t Print::print(const __FlashStringHelper* str) {
+  return write(reinterpret_cast<const char*>(str));
+}
+
+size_t Print::print(const char* str) {
+  return write(str);
+}
+
+size_t Print::print(char c) {
+  return write(static_cast<uint8_t>(c));
+}
+
+size_t Print::print(int n, int base) {
+  return print(static_cast<long>(n), base);
+}
+
+size_t Print::print(unsigned int n, int base) {
+  return print(static_cast<unsigned long>(n), base);
+}
+
+size_t Print::print(long n, int base) {
+  if (n < 0 && base == DEC) {
+    return print('-') + printNumber(0ULL - static_cast<unsigned long long>(n), DEC);
+  }
+  return printNumber(static_cast<unsigned long>(n), base);
+}
+
+size_t Print::print(unsigned long n, int base) {
+  return printNumber(n, base);
+}
+
+size_t Print::print(double n, int digits) {
+  char text[48];
+  if (isnan(n)) {
+    return write("nan");
+  }
+  snprintf(text, sizeof(text), "%.*f", digits, n);
+  return write(text);
+}
+
+size_t Print::println() {
+  return write("\r\n");
+}
+
+size_t Print::println(const __FlashStringHelper* str) {
+  return print(str) + println();
+}
+
+size_t Print::println(const char* str) {
+  return print(str) + println();
+}
+
+size_t Print::println(char c) {
+  return print(c) + println();
+}
+
+size_t Print::println(int n, int base) {
+  return print(n, base) + println();
+}
+
+size_t Print::println(unsigned int n, int base) {
+  return print(n, base) + println();
+}
+
+size_t Print::println(long n, int base) {
+  return print(n, base) + println();
+}
+
+size_t Print::println(unsigned long n, int base) {
+  return print(n, base) + println();
+}
+
+size_t Print::println(double n, int digits) {
+  return print(n, digits) + println();
+}
+
+void HardwareSerial::begin(unsigned long baud) {
+  (void)baud;
+}
+
+size_t HardwareSerial::write(uint8_t c) {
+  return fputc(c, stdout) == EOF ? 0 : 1;
+}
+
+unsigned long millis() {
+  return currentHal().nowMs;
+}
+
+/// Wall-clock microseconds, so timings measured by the firmware are real.
+unsigned long micros() {
+  using namespace std::chrono;
+  return static_cast<unsigned long>(
+      duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count());
+}
+
+/// Advances the virtual clock instead of sleeping.
+void delay(unsigned long ms) {
+  currentHal().nowMs += ms;
+}
+
+void pinMode(uint8_t pin, uint8_t mode) {
+  if (pin < VIRTUAL_HAL_PINS) {
+    currentHal().pinModes[pin] = mode;
+  }
+}
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+  if (pin < VIRTUAL_HAL_PINS) {
+    currentHal().digital[pin] = value ? HIGH : LOW;
+  }
+}
+
+int digitalRead(uint8_t pin) {
+  return pin < VIRTUAL_HAL_PINS ? currentHal().digital[pin] : LOW;
+}
+
+int analogRead(uint8_t pin) {
+  return pin < VIRTUAL_HAL_PINS ? currentHal().analog[pin] : 0;
+}
+
+long map(long x, long inMin, long inMax, long outMin, long outMax) {
+  return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
@@ -0,0 +1,95 @@
+/**
+ * @file Arduino.h
+ * @brief Minimal Arduino core for building the firmware on a host.
+ *
+ * Provides the subset of the Arduino API the firmware uses (Print, Serial, pin
+ * I/O, millis/micros, map). Pin and clock calls are routed to the per-thread
+ * VirtualHal. There is deliberately no `String` class: the firmware is heap-free,
+ * and any reintroduced `String` use fails to compile here.
+ *
+ * Project: Allpa Kawsay - IoT Agricultural Monitoring
+ * Platform: Host (Linux/macOS) simulation
+ *
+ * @author Sharon Antuanet Ivet Barrial Marin
+ * @code U202114900
+ */
+
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include "VirtualHal.h"
+
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define LOW 0x0
+#define HIGH 0x1
+#define DEC 10
+#define HEX 16
+
+class __FlashStringHelper;
+#define F(string_literal) (reinterpret_cast<const __FlashStringHelper*>(string_literal))
+
+/**
+ * @class Print
+ * @brief Arduino-compatible text output base class.
+ *
+ * Derived classes implement write(uint8_t); all formatting happens on the stack.
+ */
+class Print {
+  private:
+    size_t printNumber(unsigned long long n, uint8_t base);
+
+  public:
+    virtual ~Print() {}
+
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* buffer, size_t size);
+    size_t write(const char* str);
+
+    size_t print(const __FlashStringHelper* str);
+    size_t print(const char* str);
+    size_t print(char c);
+    size_t print(int n, int base = DEC);
+    size_t print(unsigned int n, int base = DEC);
+    size_t print(long n, int base = DEC);
+    size_t print(unsigned long n, int base = DEC);
+    size_t print(double n, int digits = 2);
+
+    size_t println();
+    size_t println(const __FlashStringHelper* str);
+    size_t println(const char* str);
+    size_t println(char c);
+    size_t println(int n, int base = DEC);
+    size_t println(unsigned int n, int base = DEC);
+    size_t println(long n, int base = DEC);
+    size_t println(unsigned long n, int base = DEC);
+    size_t println(double n, int digits = 2);
+};
+
+/**
+ * @class HardwareSerial
+ * @brief Serial port writing to the process's standard output.
+ */
+class HardwareSerial : public Print {
+  public:
+    void begin(unsigned long baud);
+    size_t write(uint8_t c) override;
+    using Print::write;
+};
+
+extern HardwareSerial Serial;
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+int analogRead(uint8_t pin);
+long map(long x, long inMin, long inMax, long outMin, long outMax);
+
+#endif // HOST_ARDUINO_H
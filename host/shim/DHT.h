@@ -0,0 +1,42 @@
+/**
+ * @file DHT.h
+ * @brief Host stand-in for the Adafruit DHT sensor library.
+ *
+ * Readings come from the temperature and humidity of the current VirtualHal.
+ *
+ * Project: Allpa Kawsay - IoT Agricultural Monitoring
+ * Platform: Host (Linux/macOS) simulation
+ *
+ * @author Sharon Antuanet Ivet Barrial Marin
+ * @code U202114900
+ */
+
+#ifndef HOST_DHT_H
+#define HOST_DHT_H
+
+#include <Arduino.h>
+
+#define DHT22 22
+
+/**
+ * @class DHT
+ * @brief Simulated DHT temperature/humidity sensor.
+ */
+class DHT {
+  private:
+    uint8_t pin;  ///< Data pin (configured as input on begin()).
+
+  public:
+    DHT(uint8_t pin, uint8_t type, uint8_t count = 6) : pin(pin) {
+      (void)type;
+      (void)count;
+    }
+
+    void begin() { pinMode(pin, INPUT); }
+
+    float readTemperature() { return currentHal().temperature; }
+
+    float readHumidity() { return currentHal().humidity; }
+};
+
+#endif // HOST_DHT_H
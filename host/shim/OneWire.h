@@ -0,0 +1,15 @@
+/**
+ * @file OneWire.h
+ * @brief Host stand-in for the OneWire library (included but unused by the firmware).
+ *
+ * Project: Allpa Kawsay - IoT Agricultural Monitoring
+ * Platform: Host (Linux/macOS) simulation
+ *
+ * @author Sharon Antuanet Ivet Barrial Marin
+ * @code U202114900
+ */
+
+#ifndef HOST_ONE_WIRE_H
+#define HOST_ONE_WIRE_H
+
+#endif // HOST_ONE_WIRE_H
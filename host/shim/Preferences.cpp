@@ -0,0 +1,78 @@
+/**
+ * @file Preferences.cpp
+ * @brief Implementation of the in-memory Preferences stand-in.
+ *
+ * All instances share one mutex-protected store, like NVS on the device.
+ *
+ * Project: Allpa Kawsay - IoT Agricultural Monitoring
+ * Platform: Host (Linux/macOS) simulation
+ *
+ * @author Sharon Antuanet Ivet Barrial Marin
+ * @code U202114900
+ */
+
+#include "Preferences.h"
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+static std::mutex storeMutex;                                    ///< Guards `store`.
+static std::map<std::string, std::vector<uint8_t>> store;        ///< "namespace/key" -> value.
+
+/// Builds the store key for a namespace entry.
+static std::string entryName(const char* name, const char* key) {
+  return std::string(name) + "/" + key;
+}
+
+Preferences::Preferences() : name(nullptr), readOnly(true) {}
+
+bool Preferences::begin(const char* name, bool readOnly) {
+  this->name = name;
+  this->readOnly = readOnly;
+  return name != nullptr;
+}
+
+void Preferences::end() {
+  name = nullptr;
+}
+
+size_t Preferences::getBytesLength(const char* key) {
+  if (name == nullptr) {
+    return 0;
+  }
+  std::lock_guard<std::mutex> lock(storeMutex);
+  auto entry = store.find(entryName(name, key));
+  return entry == store.end() ? 0 : entry->second.size();
+}
+
+size_t Preferences::getBytes(const char* key, void* buffer, size_t maxLength) {
+  if (name == nullptr) {
+    return 0;
+  }
+  std::lock_guard<std::mutex> lock(storeMutex);
+  auto entry = store.find(entryName(name, key));
+  if (entry == store.end() || entry->second.size() > maxLength) {
+    return 0;
+  }
+  memcpy(buffer, entry->second.data(), entry->second.size());
+  return entry->second.size();
+}
+
+size_t Preferences::putBytes(const char* key, const void* value, size_t length) {
+  if (name == nullptr || readOnly) {
+    return 0;
+  }
+  const uint8_t* bytes = static_cast<const uint8_t*>(value);
+  std::lock_guard<std::mutex> lock(storeMutex);
+  store[entryName(name, key)].assign(bytes, bytes + length);
+  return length;
+}
+
+bool Preferences::remove(const char* key) {
+  if (name == nullptr || readOnly) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(storeMutex);
+  return store.erase(entryName(name, key)) > 0;
+}
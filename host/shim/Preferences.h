@@ -0,0 +1,39 @@
+/**
+ * @file Preferences.h
+ * @brief Host stand-in for the ESP32 Preferences (NVS) library.
+ *
+ * Keeps namespaces in process memory; contents are lost when the process exits.
+ *
+ * Project: Allpa Kawsay - IoT Agricultural Monitoring
+ * Platform: Host (Linux/macOS) simulation
+ *
+ * @author Sharon Antuanet Ivet Barrial Marin
+ * @code U202114900
+ */
+
+#ifndef HOST_PREFERENCES_H
+#define HOST_PREFERENCES_H
+
+#include <Arduino.h>
+
+/**
+ * @class Preferences
+ * @brief In-memory key/value store with the Preferences byte API.
+ */
+class Preferences {
+  private:
+    const char* name;  ///< Open namespace, nullptr when closed.
+    bool readOnly;     ///< True if opened read-only.
+
+  public:
+    Preferences();
+
+    bool begin(const char* name, bool readOnly = false);
+    void end();
+    size_t getBytesLength(const char* key);
+    size_t getBytes(const char* key, void* buffer, size_t maxLength);
+    size_t putBytes(const char* key, const void* value, size_t length);
+    bool remove(const char* key);
+};
+
+#endif // HOST_PREFERENCES_H
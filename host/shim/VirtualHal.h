@@ -0,0 +1,52 @@
+/**
+ * @file VirtualHal.h
+ * @brief Per-thread virtual hardware behind the host Arduino shim.
+ *
+ * Every Arduino pin, clock and sensor call made by the firmware on a host build
+ * is served from the VirtualHal selected on the calling thread. A simulator
+ * selects an instance's HAL before stepping it, so thousands of controllers can
+ * share one process without sharing hardware state.
+ *
+ * Project: Allpa Kawsay - IoT Agricultural Monitoring
+ * Platform: Host (Linux/macOS) simulation
+ *
+ * @author Sharon Antuanet Ivet Barrial Marin
+ * @code U202114900
+ */
+
+#ifndef VIRTUAL_HAL_H
+#define VIRTUAL_HAL_H
+
+#include <stdint.h>
+
+/// Number of GPIOs modelled (ESP32 exposes GPIO 0-39).
+#define VIRTUAL_HAL_PINS 40
+
+/**
+ * @struct VirtualHal
+ * @brief State of one simulated board.
+ */
+struct VirtualHal {
+  unsigned long nowMs;                  ///< Virtual monotonic clock returned by millis().
+  uint16_t analog[VIRTUAL_HAL_PINS];    ///< Values returned by analogRead() (0-4095).
+  uint8_t digital[VIRTUAL_HAL_PINS];    ///< Levels written by digitalWrite().
+  uint8_t pinModes[VIRTUAL_HAL_PINS];   ///< Modes set by pinMode().
+  float temperature;                    ///< Value returned by DHT::readTemperature() (°C).
+  float humidity;                       ///< Value returned by DHT::readHumidity() (%).
+};
+
+/**
+ * @brief Returns the HAL selected on the calling thread.
+ *
+ * Falls back to a per-thread default board when none was selected.
+ */
+VirtualHal& currentHal();
+
+/**
+ * @brief Selects the HAL used by Arduino calls on the calling thread.
+ *
+ * @param hal Board to use, or nullptr to return to the per-thread default.
+ */
+void selectHal(VirtualHal* hal);
+
+#endif // VIRTUAL_HAL_H
@@ -0,0 +1,43 @@
+/**
+ * @file WiFi.h
+ * @brief Host stand-in for the ESP32 WiFi library.
+ *
+ * Simulated nodes run without network, so the station never connects.
+ *
+ * Project: Allpa Kawsay - IoT Agricultural Monitoring
+ * Platform: Host (Linux/macOS) simulation
+ *
+ * @author Sharon Antuanet Ivet Barrial Marin
+ * @code U202114900
+ */
+
+#ifndef HOST_WIFI_H
+#define HOST_WIFI_H
+
+#include <Arduino.h>
+
+#define WIFI_STA 1
+#define WL_CONNECTED 3
+#define WL_DISCONNECTED 6
+
+/**
+ * @class WiFiClass
+ * @brief Offline WiFi station.
+ */
+class WiFiClass {
+  public:
+    void mode(int mode) { (void)mode; }
+
+    void begin(const char* ssid, const char* password) {
+      (void)ssid;
+      (void)password;
+    }
+
+    int status() { return WL_DISCONNECTED; }
+
+    bool isConnected() { return false; }
+};
+
+inline WiFiClass WiFi;
+
+#endif // HOST_WIFI_H
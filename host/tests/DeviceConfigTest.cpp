@@ -0,0 +1,212 @@
+/**
+ * @file DeviceConfigTest.cpp
+ * @brief Host tests for the binary DeviceConfig record and the double-buffered apply path.
+ *
+ * Covers sealing, in-place validation, rejection of corrupt or out-of-range
+ * records, busy/rejected/applied statuses, pin hand-over in update(), per-key
+ * persistence, and the time applyConfig() takes to validate and swap a record.
+ *
+ * Project: Allpa Kawsay - IoT Agricultural Monitoring
+ * Platform: Host (Linux/macOS) simulation
+ *
+ * @author Sharon Antuanet Ivet Barrial Marin
+ * @code U202114900
+ */
+
+#include <chrono>
+#include <stdio.h>
+#include "SmartIrrigationController.h"
+
+/// Number of timed validate-and-swap operations.
+static const int TIMED_APPLIES = 20000;
+/// Upper bound on the mean validate-and-swap time; generous so slow CI hosts pass.
+static const double MAX_MEAN_APPLY_MICROS = 50.0;
+
+static int failures = 0;  ///< Failed checks so far.
+
+#define CHECK(condition)                                                   \
+  do {                                                                     \
+    if (!(condition)) {                                                    \
+      fprintf(stderr, "%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #condition); \
+      failures++;                                                          \
+    }                                                                      \
+  } while (0)
+
+/**
+ * @class NullPrint
+ * @brief Discards controller output.
+ */
+class NullPrint : public Print {
+  public:
+    size_t write(uint8_t c) override {
+      (void)c;
+      return 1;
+    }
+    using Print::write;
+};
+
+/// Returns the record bytes as a blob for applyConfig().
+static const uint8_t* blobOf(const DeviceConfig& config) {
+  return reinterpret_cast<const uint8_t*>(&config);
+}
+
+/// Returns a sealed copy of `base` after applying `edit` to it.
+template <typename Edit>
+static DeviceConfig sealedWith(const DeviceConfig& base, Edit edit) {
+  DeviceConfig config = base;
+  edit(config);
+  sealDeviceConfig(config);
+  return config;
+}
+
+static void testSealAndValidate(const DeviceConfig& base) {
+  CHECK(isValidDeviceConfig(base));
+  CHECK(base.magic == DEVICE_CONFIG_MAGIC);
+  CHECK(base.version == DEVICE_CONFIG_VERSION);
+  CHECK(base.size == sizeof(DeviceConfig));
+  CHECK(base.crc == deviceConfigCrc(base));
+
+  // Any flipped payload bit breaks the CRC.
+  for (size_t offset = 12; offset < sizeof(DeviceConfig); offset++) {
+    DeviceConfig corrupt = base;
+    reinterpret_cast<uint8_t*>(&corrupt)[offset] ^= 0x01;
+    CHECK(!isValidDeviceConfig(corrupt));
+  }
+
+  // Header fields are checked even with a matching CRC.
+  DeviceConfig wrongMagic = base;
+  wrongMagic.magic ^= 1;
+  CHECK(!isValidDeviceConfig(wrongMagic));
+  DeviceConfig wrongVersion = base;
+  wrongVersion.version++;
+  wrongVersion.crc = deviceConfigCrc(wrongVersion);
+  CHECK(!isValidDeviceConfig(wrongVersion));
+}
+
+static void testFieldRanges(const DeviceConfig& base) {
+  CHECK(!isValidDeviceConfig(sealedWith(base, [](DeviceConfig& c) { c.reserved = 1; })));
+  CHECK(!isValidDeviceConfig(sealedWith(base, [](DeviceConfig& c) { c.padding[1] = 1; })));
+  CHECK(!isValidDeviceConfig(sealedWith(base, [](DeviceConfig& c) {
+    c.mac[MAC_ADDRESS_CAPACITY - 1] = 'X';
+  })));
+  CHECK(!isValidDeviceConfig(sealedWith(base, [](DeviceConfig& c) { c.openBelowPercent = 90.0f; })));
+  CHECK(!isValidDeviceConfig(sealedWith(base, [](DeviceConfig& c) { c.manualAbovePercent = 101.0f; })));
+  CHECK(!isValidDeviceConfig(sealedWith(base, [](DeviceConfig& c) { c.reportPeriodMs = 0; })));
+
+  // Pins: range, flash pins, soil pin off ADC1, input-only outputs, collisions.
+  CHECK(!isValidDeviceConfig(sealedWith(base, [](DeviceConfig& c) { c.valvePin = 255; })));
+  CHECK(!isValidDeviceConfig(sealedWith(base, [](DeviceConfig& c) { c.soilPin = 40; })));
+  CHECK(!isValidDeviceConfig(sealedWith(base, [](DeviceConfig& c) { c.soilPin = 21; })));
+  CHECK(!isValidDeviceConfig(sealedWith(base, [](DeviceConfig& c) { c.soilPin = 13; })));
+  CHECK(!isValidDeviceConfig(sealedWith(base, [](DeviceConfig& c) { c.soilPin = 27; })));
+  CHECK(!isValidDeviceConfig(sealedWith(base, [](DeviceConfig& c) { c.valvePin = 6; })));
+  CHECK(!isValidDeviceConfig(sealedWith(base, [](DeviceConfig& c) { c.ambientPin = 24; })));
+  CHECK(!isValidDeviceConfig(sealedWith(base, [](DeviceConfig& c) { c.valvePin = 35; })));
+  CHECK(!isValidDeviceConfig(sealedWith(base, [](DeviceConfig& c) { c.ambientPin = 36; })));
+  CHECK(!isValidDeviceConfig(sealedWith(base, [](DeviceConfig& c) { c.valvePin = c.soilPin; })));
+  CHECK(!isValidDeviceConfig(sealedWith(base, [](DeviceConfig& c) { c.ambientPin = c.valvePin; })));
+
+  // Valid alternatives are still accepted.
+  CHECK(isValidDeviceConfig(sealedWith(base, [](DeviceConfig& c) { c.soilPin = 39; })));
+  CHECK(isValidDeviceConfig(sealedWith(base, [](DeviceConfig& c) { c.soilPin = 32; })));
+  CHECK(isValidDeviceConfig(sealedWith(base, [](DeviceConfig& c) { c.valvePin = 13; })));
+}
+
+static void testApplyStatuses() {
+  NullPrint out;
+  VirtualHal& hal = currentHal();
+  SmartIrrigationController controller("AA:BB:CC:DD:EE:FF", out);
+  controller.begin();
+
+  DeviceConfig next = sealedWith(controller.getConfig(), [](DeviceConfig& c) {
+    c.reportPeriodMs = 1000;
+    c.valvePin = 13;
+  });
+
+  CHECK(controller.applyConfig(blobOf(next), sizeof(next) - 1) == CONFIG_REJECTED);
+  CHECK(controller.applyConfig(nullptr, sizeof(next)) == CONFIG_REJECTED);
+  CHECK(controller.applyConfig(blobOf(next), sizeof(next)) == CONFIG_APPLIED);
+  CHECK(controller.getConfig().reportPeriodMs == 1000);
+  CHECK(controller.applyConfig(blobOf(next), sizeof(next)) == CONFIG_BUSY);
+
+  // update() hands the valve over to the new pin and acknowledges the swap.
+  hal.digital[12] = HIGH;
+  controller.update(100);
+  CHECK(hal.digital[12] == LOW);
+  CHECK(hal.pinModes[13] == OUTPUT);
+
+  DeviceConfig corrupt = next;
+  corrupt.reportPeriodMs = 7;
+  CHECK(controller.applyConfig(blobOf(corrupt), sizeof(corrupt)) == CONFIG_REJECTED);
+  CHECK(controller.getConfig().reportPeriodMs == 1000);
+}
+
+static void testPersistencePerKey() {
+  NullPrint out;
+  {
+    SmartIrrigationController writer("AA:BB:CC:DD:EE:01", out, nullptr, "", sntpEpochSource, "nodeA");
+    writer.begin();
+    DeviceConfig stored = sealedWith(writer.getConfig(), [](DeviceConfig& c) { c.reportPeriodMs = 2500; });
+    CHECK(writer.applyConfig(blobOf(stored), sizeof(stored)) == CONFIG_APPLIED);
+  }
+
+  SmartIrrigationController sameKey("AA:BB:CC:DD:EE:02", out, nullptr, "", sntpEpochSource, "nodeA");
+  SmartIrrigationController otherKey("AA:BB:CC:DD:EE:03", out, nullptr, "", sntpEpochSource, "nodeB");
+  SmartIrrigationController noKey("AA:BB:CC:DD:EE:04", out);
+  sameKey.begin();
+  otherKey.begin();
+  noKey.begin();
+  CHECK(sameKey.getConfig().reportPeriodMs == 2500);
+  CHECK(otherKey.getConfig().reportPeriodMs == 5000);
+  CHECK(noKey.getConfig().reportPeriodMs == 5000);
+}
+
+static void testApplyTiming() {
+  NullPrint out;
+  SmartIrrigationController controller("AA:BB:CC:DD:EE:FF", out);
+  controller.begin();
+
+  DeviceConfig records[2];
+  records[0] = sealedWith(controller.getConfig(), [](DeviceConfig& c) { c.reportPeriodMs = 4000; });
+  records[1] = sealedWith(controller.getConfig(), [](DeviceConfig& c) { c.reportPeriodMs = 6000; });
+
+  std::chrono::steady_clock::duration total(0);
+  std::chrono::steady_clock::duration slowest(0);
+  for (int i = 0; i < TIMED_APPLIES; i++) {
+    const DeviceConfig& record = records[i % 2];
+    auto start = std::chrono::steady_clock::now();
+    ConfigApplyResult result = controller.applyConfig(blobOf(record), sizeof(record));
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    CHECK(result == CONFIG_APPLIED);
+
+    total += elapsed;
+    if (elapsed > slowest) {
+      slowest = elapsed;
+    }
+    controller.update(static_cast<unsigned long>(i) * 100);
+  }
+
+  double meanMicros = std::chrono::duration<double, std::micro>(total).count() / TIMED_APPLIES;
+  double maxMicros = std::chrono::duration<double, std::micro>(slowest).count();
+  printf("applyConfig: mean %.3f us, max %.3f us over %d applies\n", meanMicros, maxMicros, TIMED_APPLIES);
+  CHECK(controller.getConfig().reportPeriodMs == 6000);
+  CHECK(meanMicros < MAX_MEAN_APPLY_MICROS);
+}
+
+int main() {
+  NullPrint out;
+  SmartIrrigationController defaults("AA:BB:CC:DD:EE:FF", out);
+
+  testSealAndValidate(defaults.getConfig());
+  testFieldRanges(defaults.getConfig());
+  testApplyStatuses();
+  testPersistencePerKey();
+  testApplyTiming();
+
+  if (failures > 0) {
+    fprintf(stderr, "FAIL: %d check(s) failed\n", failures);
+    return 1;
+  }
+  printf("PASS\n");
+  return 0;
+}
@@ -0,0 +1,161 @@
+/**
+ * @file HeapFreeTest.cpp
+ * @brief Host check that the controller performs no heap allocation after begin().
+ *
+ * Global operator new is replaced with a counting version. After begin(), the
+ * controller runs long enough to sync time, publish reports and auto-switch mode,
+ * hot-applies two configuration records that move every component to other pins
+ * (so update() rebuilds the sensors and valve), plus explicit setMode() calls;
+ * any allocation in that window fails the test.
+ *
+ * Project: Allpa Kawsay - IoT Agricultural Monitoring
+ * Platform: Host (Linux/macOS) simulation
+ *
+ * @author Sharon Antuanet Ivet Barrial Marin
+ * @code U202114900
+ */
+
+#include <atomic>
+#include <new>
+#include <stdio.h>
+#include <stdlib.h>
+#include "SmartIrrigationController.h"
+
+static std::atomic<bool> counting(false);          ///< Allocation counting enabled.
+static std::atomic<unsigned long> allocations(0);  ///< Allocations seen while counting.
+
+void* operator new(size_t size) {
+  if (counting.load(std::memory_order_relaxed)) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+  }
+  void* memory = malloc(size == 0 ? 1 : size);
+  if (memory == nullptr) {
+    throw std::bad_alloc();
+  }
+  return memory;
+}
+
+void* operator new[](size_t size) {
+  return operator new(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+  if (counting.load(std::memory_order_relaxed)) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+  }
+  return malloc(size == 0 ? 1 : size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t& tag) noexcept {
+  return operator new(size, tag);
+}
+
+void operator delete(void* memory) noexcept {
+  free(memory);
+}
+
+void operator delete[](void* memory) noexcept {
+  free(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept {
+  free(memory);
+}
+
+void operator delete[](void* memory, size_t) noexcept {
+  free(memory);
+}
+
+/**
+ * @class CountingPrint
+ * @brief Output that only counts bytes, so the test itself never allocates.
+ */
+class CountingPrint : public Print {
+  public:
+    unsigned long written = 0;  ///< Bytes written.
+
+    size_t write(uint8_t c) override {
+      (void)c;
+      written++;
+      return 1;
+    }
+    using Print::write;
+};
+
+/// Simulated SNTP: valid from 1 s of uptime on.
+static bool testEpochSource(int64_t& epochMs) {
+  if (millis() < 1000) {
+    return false;
+  }
+  epochMs = 1767225600000LL + millis();
+  return true;
+}
+
+/// Returns a sealed copy of `base` with the given pins and thresholds.
+static DeviceConfig reconfigured(const DeviceConfig& base, uint8_t soilPin, uint8_t ambientPin,
+                                 uint8_t valvePin, float openBelow, float manualAbove) {
+  DeviceConfig config = base;
+  config.soilPin = soilPin;
+  config.ambientPin = ambientPin;
+  config.valvePin = valvePin;
+  config.openBelowPercent = openBelow;
+  config.manualAbovePercent = manualAbove;
+  sealDeviceConfig(config);
+  return config;
+}
+
+int main() {
+  CountingPrint out;
+  SmartIrrigationController controller("AA:BB:CC:DD:EE:FF", out, nullptr, "", testEpochSource);
+  VirtualHal& hal = currentHal();
+
+  controller.begin();
+  controller.printMemoryReport();
+
+  // Prepared before counting starts; applying them is what is measured.
+  const DeviceConfig moved = reconfigured(controller.getConfig(), 35, 15, 13, 30.0f, 70.0f);
+  const DeviceConfig restored = reconfigured(controller.getConfig(), 34, 4, 12, 40.0f, 80.0f);
+  int failedApplies = 0;
+
+  counting.store(true);
+  for (unsigned long tick = 1; tick <= 2000; tick++) {
+    hal.nowMs = tick * 100;
+    // Dry soil for the first half (valve opens), then saturate it (auto-switch to MANUAL).
+    // Both soil pins carry the reading, since the sensor moves between them.
+    hal.analog[34] = tick < 1000 ? 3500 : 200;
+    hal.analog[35] = hal.analog[34];
+    if (tick == 500 &&
+        controller.applyConfig(reinterpret_cast<const uint8_t*>(&moved), sizeof(moved)) != CONFIG_APPLIED) {
+      failedApplies++;
+    }
+    if (tick == 1200 &&
+        controller.applyConfig(reinterpret_cast<const uint8_t*>(&restored), sizeof(restored)) != CONFIG_APPLIED) {
+      failedApplies++;
+    }
+    controller.update(hal.nowMs);
+    if (tick == 500 && hal.pinModes[13] != OUTPUT) {
+      failedApplies++;
+    }
+    if (tick == 1500) {
+      controller.setMode("AUTO");
+    }
+  }
+  controller.setMode("MANUAL");
+  controller.setMode("INVALID");
+  counting.store(false);
+
+  if (failedApplies != 0 || controller.getConfig().soilPin != 34) {
+    fprintf(stderr, "FAIL: configuration hot reload did not take effect\n");
+    return 1;
+  }
+  if (out.written == 0) {
+    fprintf(stderr, "FAIL: controller produced no output\n");
+    return 1;
+  }
+  if (allocations.load() != 0) {
+    fprintf(stderr, "FAIL: %lu heap allocations after begin()\n", allocations.load());
+    return 1;
+  }
+  printf("PASS: 0 heap allocations in 2000 updates and 2 config reloads (%lu bytes of output)\n", out.written);
+  return 0;
+}
@@ -0,0 +1,69 @@
+/**
+ * @file WorkStealingPoolTest.cpp
+ * @brief Stress test for back-to-back batches on the work-stealing pool.
+ *
+ * Runs many small batches in a row with more workers than tasks, so workers
+ * regularly finish a batch while others are still leaving it. Every task must
+ * run exactly once, with the body of its own batch; a worker that carries over
+ * into the next batch shows up as a wrong batch id, a double run or a hang
+ * (caught by the ctest timeout).
+ *
+ * Project: Allpa Kawsay - IoT Agricultural Monitoring
+ * Platform: Host (Linux/macOS) simulation
+ *
+ * @author Sharon Antuanet Ivet Barrial Marin
+ * @code U202114900
+ */
+
+#include <atomic>
+#include <stdio.h>
+#include <thread>
+#include "WorkStealingPool.h"
+
+/// Number of consecutive batches.
+static const size_t BATCHES = 20000;
+/// Largest batch; kept small so batches turn over quickly.
+static const size_t MAX_TASKS = 8;
+/// Workers per pool; more than MAX_TASKS / 2 so some always find nothing to do.
+static const size_t THREADS = 6;
+
+int main() {
+  WorkStealingPool pool(THREADS);
+  std::atomic<unsigned> runs[MAX_TASKS];
+  std::atomic<size_t> owner[MAX_TASKS];
+  unsigned long failures = 0;
+
+  for (size_t batch = 0; batch < BATCHES; batch++) {
+    size_t count = 1 + batch % MAX_TASKS;
+    for (size_t i = 0; i < MAX_TASKS; i++) {
+      runs[i].store(0);
+      owner[i].store(BATCHES);
+    }
+
+    pool.parallelFor(count, [&, batch](size_t i) {
+      runs[i].fetch_add(1);
+      owner[i].store(batch);
+      if (i % 3 == 0) {
+        std::this_thread::yield();
+      }
+    });
+
+    for (size_t i = 0; i < MAX_TASKS; i++) {
+      unsigned expectedRuns = i < count ? 1 : 0;
+      if (runs[i].load() != expectedRuns || (i < count && owner[i].load() != batch)) {
+        if (failures++ < 10) {
+          fprintf(stderr, "batch %zu task %zu: ran %u time(s), body of batch %zu\n",
+                  batch, i, runs[i].load(), owner[i].load());
+        }
+      }
+    }
+  }
+
+  if (failures > 0) {
+    fprintf(stderr, "FAIL: %lu task(s) ran wrongly\n", failures);
+    return 1;
+  }
+  printf("PASS: %zu batches on %zu workers, %llu steals\n",
+         BATCHES, pool.size(), (unsigned long long)pool.steals());
+  return 0;
+}
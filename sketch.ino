@@ -14,8 +14,16 @@
 
 #include "SmartIrrigationController.h"
 
-// Create an instance of the controller with a mock MAC address
-SmartIrrigationController controller("AA:BB:CC:DD:EE:FF");
+/// WiFi credentials for Wokwi simulation
+const char* WIFI_SSID = "Wokwi-GUEST";
+const char* WIFI_PASSWORD = "";
+
+/// Preferences key under which this node persists its configuration record.
+const char* CONFIG_KEY = "config";
+
+// Create an instance of the controller with a mock MAC address, reporting over Serial
+SmartIrrigationController controller("AA:BB:CC:DD:EE:FF", Serial, WIFI_SSID, WIFI_PASSWORD,
+                                     sntpEpochSource, CONFIG_KEY);
 
 /**
  * @brief Arduino setup function.
@@ -25,13 +33,15 @@ SmartIrrigationController controller("AA:BB:CC:DD:EE:FF");
 void setup() {
   Serial.begin(9600);
   controller.begin();
+  controller.printMemoryReport();
 }
 
 /**
  * @brief Arduino loop function.
  * 
  * Periodically calls the controller's update method to manage sensor readings,
- * automatic irrigation logic, and JSON status reporting.
+ * automatic irrigation logic, and JSON status reporting. The update path does not
+ * allocate heap memory; host/tests/HeapFreeTest.cpp checks this off-device.
  */
 void loop() {
   controller.update();